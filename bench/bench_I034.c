@@ -0,0 +1,234 @@
+/**
+ * @file bench_I034.c
+ * @brief Encode/decode throughput of the Category 034 data items
+ * @version 0.1
+ * @date 2026-03-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Each item is encoded once into a scratch buffer and then decoded repeatedly
+ * from it; the figures are nanoseconds per item and items per second.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Common/constants.h>
+#include <Categories/I034/I034.h>
+#include <Categories/I034/I034_Compact.h>
+#include <Categories/I034/I034_Builder.h>
+
+/* ================================= MACROS ================================= */
+
+#define BENCH_ITERATIONS    2000000UL
+#define BENCH_BUFFER_LEN    MAX_MESSAGE_LEN
+#define BENCH_BLOCK_RECORDS 16U
+
+/* Time BENCH_ITERATIONS calls of `stmt` on a BitStream rewound each time */
+#define BENCH_RUN(label, bs, buffer, stmt)                                      \
+    do {                                                                        \
+        unsigned long it_ = 0UL;                                                \
+        double t0_ = now_ns();                                                  \
+        for (it_ = 0UL; it_ < BENCH_ITERATIONS; it_++) {                        \
+            bs_init(&(bs), (buffer), BENCH_BUFFER_LEN);                         \
+            stmt;                                                               \
+        }                                                                       \
+        report((label), (now_ns() - t0_) / (double)BENCH_ITERATIONS);           \
+    } while (0)
+
+/* ================================ HELPERS ================================= */
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void report(const char * label, double ns)
+{
+    printf("%-36s %10.2f ns %14.0f /s\n", label, ns, 1e9 / ns);
+}
+
+/* Visitor that only looks at the Time of Day */
+static void on_tod(void * ctx, const I034_030 * item)
+{
+    *(I034_030 *)ctx = *item;
+}
+
+/* Locate every record of the first data block of buffer */
+static size_t walk_records(const u8 * buffer)
+{
+    AsterixBlockIter blocks;
+    AsterixBlock block;
+    AsterixRecordIter records;
+    AsterixRecord record;
+    size_t n = 0U;
+
+    block_iter_init(&blocks, buffer, BENCH_BUFFER_LEN);
+    if (block_iter_next(&blocks, &block) && (record_iter_init(&records, &block, &I034_UAP) == eAsterixStatus_OK)) {
+        while (record_iter_next(&records, &record)) {
+            n++;
+        }
+    }
+    return n;
+}
+
+/* Write the north marker of rec item by item, without its FSPEC */
+static eAsterixStatus build_north_marker(BitStream * bs, const I034 * rec)
+{
+    I034_Builder builder;
+
+    begin_I034(&builder, bs);
+    put_I034_010(&builder, &rec->I034_010);
+    put_I034_000(&builder, &rec->I034_000);
+    put_I034_030(&builder, &rec->I034_030);
+    put_I034_020(&builder, &rec->I034_020);
+    return end_I034(&builder);
+}
+
+/* ================================== MAIN ================================== */
+
+int main(void)
+{
+    static u8 buffer[BENCH_BUFFER_LEN];
+    static I034 rec;
+    static I034 out;
+    static u8 counters[2U * I034_070_MAX_REP];
+    static I034_Index index;
+    static I034_View view;
+    static I034_Compact compact;
+    static I034_CompactCold cold;
+    static I034 batch[BENCH_BLOCK_RECORDS];
+    I034_Visitor visitor = {0};
+    BitStream bs;
+    UapPlanStats stats;
+    FieldAccessor tod;
+    s64 raw = 0;
+    u8 i = 0U;
+
+    rec.I034_010.SAC = 0x12U;
+    rec.I034_010.SIC = 0x34U;
+    rec.I034_000.MSGTYPE = eI034_000_MSG_TYPE_NORTH_MARKER;
+    rec.I034_030.TOD = 43210.5F;
+    rec.I034_020.SECTAZ = 90.0F;
+    rec.I034_041.ANTROTSPD = 4.5F;
+    rec.I034_050.COM = ePresenceFlag_PRESENT;
+    rec.I034_050.PSR = ePresenceFlag_PRESENT;
+    rec.I034_050.SSR = ePresenceFlag_PRESENT;
+    rec.I034_060.COM = ePresenceFlag_PRESENT;
+    rec.I034_060.PSR = ePresenceFlag_PRESENT;
+    rec.I034_060.SSR = ePresenceFlag_PRESENT;
+    rec.I034_070.REP = 16U;
+    rec.I034_070.RAW = counters;
+    for (i = 0U; i < rec.I034_070.REP; i++) {
+        set_I034_070_COUNTER(counters, (u8)i, (eI034_070_TYP)i, (u16)(100U + i));
+    }
+    rec.I034_100.RHO_END = 200.0F;
+    rec.I034_100.THETA_END = 90.0F;
+    rec.I034_110.TYP = eI034_110_TYP_PSR;
+    rec.I034_120.HEIGHT = 120;
+    rec.I034_120.LATWGS84 = 40.5F;
+    rec.I034_120.LONWGS84 = -3.25F;
+    rec.I034_090.RANGEERR = 0.5F;
+    rec.I034_090.AZERR = -0.25F;
+
+    printf("%-36s %13s %17s\n", "operation", "time", "rate");
+
+/* Compiled-out items (see I034_config.h) have no codecs to time */
+#define BENCH_ITEM(ID)      I034_IF(ID, BENCH_ITEM_(ID))
+#define BENCH_ITEM_(ID)                                                             \
+    bs_init(&bs, buffer, BENCH_BUFFER_LEN);                                         \
+    encode_I034_##ID(&bs, &rec.I034_##ID);                                          \
+    BENCH_RUN("encode_I034_" #ID, bs, buffer, encode_I034_##ID(&bs, &rec.I034_##ID)); \
+    BENCH_RUN("decode_I034_" #ID, bs, buffer, decode_I034_##ID(&bs, &out.I034_##ID));
+
+    BENCH_ITEM(010)
+    BENCH_ITEM(000)
+    BENCH_ITEM(030)
+    BENCH_ITEM(020)
+    BENCH_ITEM(041)
+    BENCH_ITEM(050)
+    BENCH_ITEM(060)
+    BENCH_ITEM(070)
+    BENCH_ITEM(100)
+    BENCH_ITEM(110)
+    BENCH_ITEM(120)
+    BENCH_ITEM(090)
+
+#undef BENCH_ITEM
+#undef BENCH_ITEM_
+
+    /* Whole records: short north marker and every item present */
+    visitor.ctx = &out.I034_030;
+    visitor.on_I034_030 = on_tod;
+    compile_I034_field(&tod, "I034/030.TOD");
+
+    /* Items of a sector-timing consumer */
+#define BENCH_SECTOR_MASK   (I034_MASK(I034_010) | I034_MASK(I034_000) |              \
+                             I034_MASK(I034_030) | I034_MASK(I034_020))
+
+#define BENCH_RECORD(LABEL)                                                         \
+    bs_init(&bs, buffer, BENCH_BUFFER_LEN);                                         \
+    encode_I034(&bs, &rec);                                                         \
+    BENCH_RUN("encode_I034 " LABEL, bs, buffer, encode_I034(&bs, &rec));            \
+    BENCH_RUN("encoded_size_I034 " LABEL, bs, buffer,                               \
+              raw = (s64)encoded_size_I034(&rec));                                  \
+    BENCH_RUN("decode_I034 " LABEL, bs, buffer, decode_I034(&bs, &out));            \
+    BENCH_RUN("decode_I034_masked " LABEL, bs, buffer,                              \
+              decode_I034_masked(&bs, &out, BENCH_SECTOR_MASK));                    \
+    BENCH_RUN("decode_I034_compact " LABEL, bs, buffer,                             \
+              decode_I034_compact(&bs, &compact, &cold));                           \
+    BENCH_RUN("index_I034 " LABEL, bs, buffer, index_I034(&bs, &index));            \
+    BENCH_RUN("visit_I034 + 030 " LABEL, bs, buffer, visit_I034(&bs, &visitor));    \
+    BENCH_RUN("view_I034 + 030 " LABEL, bs, buffer,                                 \
+              (view_I034(&view, buffer, BENCH_BUFFER_LEN),                          \
+               view_I034_030(&view, &out.I034_030)));                               \
+    BENCH_RUN("view_I034 + field 030 " LABEL, bs, buffer,                           \
+              (view_I034(&view, buffer, BENCH_BUFFER_LEN),                          \
+               read_I034_field(&view, &tod, &raw)));
+
+    I034_FSPEC_SET(&rec.FSPEC, I034_010);
+    I034_FSPEC_SET(&rec.FSPEC, I034_000);
+    I034_FSPEC_SET(&rec.FSPEC, I034_030);
+    I034_FSPEC_SET(&rec.FSPEC, I034_020);
+    BENCH_RECORD("(north marker)")
+    BENCH_RUN("put_I034 (north marker)", bs, buffer, build_north_marker(&bs, &rec));
+
+    /* Every item built into the library */
+    I034_IF(041, I034_FSPEC_SET(&rec.FSPEC, I034_041));
+    I034_IF(050, I034_FSPEC_SET(&rec.FSPEC, I034_050));
+    I034_IF(060, I034_FSPEC_SET(&rec.FSPEC, I034_060));
+    I034_IF(070, I034_FSPEC_SET(&rec.FSPEC, I034_070));
+    I034_IF(100, I034_FSPEC_SET(&rec.FSPEC, I034_100));
+    I034_IF(110, I034_FSPEC_SET(&rec.FSPEC, I034_110));
+    I034_IF(120, I034_FSPEC_SET(&rec.FSPEC, I034_120));
+    I034_IF(090, I034_FSPEC_SET(&rec.FSPEC, I034_090));
+    BENCH_RECORD("(all items)")
+
+#undef BENCH_RECORD
+#undef BENCH_SECTOR_MASK
+
+    /* Data block of north markers back to back: figures are per block */
+    rec.FSPEC.present = 0U;
+    I034_FSPEC_SET(&rec.FSPEC, I034_010);
+    I034_FSPEC_SET(&rec.FSPEC, I034_000);
+    I034_FSPEC_SET(&rec.FSPEC, I034_030);
+    I034_FSPEC_SET(&rec.FSPEC, I034_020);
+    bs_init(&bs, buffer, BENCH_BUFFER_LEN);
+    for (i = 0U; i < BENCH_BLOCK_RECORDS; i++) {
+        encode_I034(&bs, &rec);
+    }
+    BENCH_RUN("decode_I034_batch (16 records)", bs, buffer, decode_I034_batch(&bs, batch, BENCH_BLOCK_RECORDS));
+    BENCH_RUN("record_iter (16 records)", bs, buffer, walk_records(buffer));
+
+    uap_plan_stats(&stats);
+    printf("decode plan cache: %llu hits, %llu misses, %llu evictions\n",
+           (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+           (unsigned long long)stats.evictions);
+
+    return (out.I034_010.SAC == rec.I034_010.SAC) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
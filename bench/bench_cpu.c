@@ -0,0 +1,158 @@
+/**
+ * @file bench_cpu.c
+ * @brief Throughput of the dispatched kernels at every supported CPU level
+ * @version 0.1
+ * @date 2026-03-21
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Each level the host can run is forced in turn with asterix_cpu_set_level()
+ * and its outputs are compared with the scalar reference (for every length up
+ * to BENCH_CHECK_LEN, so that the vector tails are covered) before timing.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Infra/cpu_dispatch.h>
+
+/* ================================= MACROS ================================= */
+
+#define BENCH_ITERATIONS    20000UL
+#define BENCH_LEN           4096U
+#define BENCH_CHECK_LEN     100U
+
+/* ================================ HELPERS ================================= */
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* Compare the kernels in use with the scalar ones for every length/start */
+static int check_level(const AsterixKernels * ref)
+{
+    static u8 src[2U * BENCH_CHECK_LEN];
+    u16 w_ref[BENCH_CHECK_LEN], w_lib[BENCH_CHECK_LEN];
+#ifndef ASTERIX_NO_FLOAT
+    static s32 raw[BENCH_CHECK_LEN];
+    float f_ref[BENCH_CHECK_LEN], f_lib[BENCH_CHECK_LEN];
+#endif
+    size_t n = 0U;
+    size_t end = 0U;
+
+    for (n = 0U; n < sizeof(src); n++) {
+        src[n] = (u8)(rand() | 1);
+    }
+#ifndef ASTERIX_NO_FLOAT
+    for (n = 0U; n < BENCH_CHECK_LEN; n++) {
+        raw[n] = (s32)((u32)rand() << 8U) >> 8;
+    }
+#endif
+
+    for (n = 0U; n <= BENCH_CHECK_LEN; n++) {
+        /* FX chain ending at every possible octet, and not ending at all */
+        for (end = 0U; end <= n; end++) {
+            if (end < n)
+                src[end] &= 0xFEU;
+            if (asterix_fx_scan(src, n) != ref->fx_scan(src, n))
+                return 0;
+            if (end < n)
+                src[end] |= 0x01U;
+        }
+
+        asterix_be16_unpack(w_lib, src, n);
+        ref->be16_unpack(w_ref, src, n);
+        if (memcmp(w_lib, w_ref, n * sizeof(u16)) != 0)
+            return 0;
+
+#ifndef ASTERIX_NO_FLOAT
+        asterix_raw_to_float(f_lib, raw, n, 180.0 / 8388608.0);
+        ref->raw_to_float(f_ref, raw, n, 180.0 / 8388608.0);
+        if (memcmp(f_lib, f_ref, n * sizeof(float)) != 0)
+            return 0;
+#endif
+    }
+    return 1;
+}
+
+static void bench_level(void)
+{
+    static u8 src[2U * BENCH_LEN];
+    static u16 words[BENCH_LEN];
+#ifndef ASTERIX_NO_FLOAT
+    static s32 raw[BENCH_LEN];
+    static float out[BENCH_LEN];
+#endif
+    volatile size_t sink = 0U;
+    unsigned long it = 0UL;
+    double t0, t_fx, t_be16, t_float = 0.0;
+
+    memset(src, 0xFF, sizeof(src));
+    src[BENCH_LEN - 1U] = 0x00U;
+#ifndef ASTERIX_NO_FLOAT
+    for (it = 0UL; it < BENCH_LEN; it++) {
+        raw[it] = (s32)it - (s32)(BENCH_LEN / 2U);
+    }
+#endif
+
+    t0 = now_ns();
+    for (it = 0UL; it < BENCH_ITERATIONS; it++) {
+        sink += asterix_fx_scan(src, BENCH_LEN);
+    }
+    t_fx = (now_ns() - t0) / (double)BENCH_ITERATIONS;
+
+    t0 = now_ns();
+    for (it = 0UL; it < BENCH_ITERATIONS; it++) {
+        asterix_be16_unpack(words, src, BENCH_LEN);
+    }
+    t_be16 = (now_ns() - t0) / (double)BENCH_ITERATIONS;
+
+#ifndef ASTERIX_NO_FLOAT
+    /* No conversion kernel without floating point: reported as 0 */
+    t0 = now_ns();
+    for (it = 0UL; it < BENCH_ITERATIONS; it++) {
+        asterix_raw_to_float(out, raw, BENCH_LEN, 1.0 / 128.0);
+    }
+    t_float = (now_ns() - t0) / (double)BENCH_ITERATIONS;
+#endif
+
+    printf("%-8s %14.3f %14.3f %14.3f\n", asterix_cpu_level_name(asterix_cpu_level()),
+           t_fx / BENCH_LEN, t_be16 / BENCH_LEN, t_float / BENCH_LEN);
+    (void)sink;
+}
+
+/* ================================== MAIN ================================== */
+
+int main(void)
+{
+    AsterixKernels ref;
+    int level = 0;
+
+    if (!asterix_cpu_set_level(eAsterixCpuLevel_SCALAR)) {
+        return EXIT_FAILURE;
+    }
+    ref = *asterix_kernels;
+
+    printf("detected level: %s\n", asterix_cpu_level_name(asterix_cpu_detect()));
+    printf("%-8s %14s %14s %14s\n", "level", "fx_scan ns/B", "be16 ns/word", "float ns/val");
+
+    for (level = eAsterixCpuLevel_SCALAR; level <= eAsterixCpuLevel_NEON; level++) {
+        if (!asterix_cpu_set_level((eAsterixCpuLevel)level)) {
+            continue;
+        }
+        if (!check_level(&ref)) {
+            fprintf(stderr, "%s kernels differ from the scalar reference\n",
+                    asterix_cpu_level_name((eAsterixCpuLevel)level));
+            return EXIT_FAILURE;
+        }
+        bench_level();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,274 @@
+/**
+ * @file bench_infra.c
+ * @brief Throughput of the BitStream engine against the former per-bit loops
+ * @version 0.1
+ * @date 2026-03-14
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * For every CAT034 item layout the same field sequence is serialized and
+ * deserialized with the library engine and with the per-bit reference below
+ * (the implementation the engine replaced). Outputs are compared byte by byte
+ * before timing, so the benchmark also acts as an equivalence check.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <Infra/infra.h>
+
+/* ================================= MACROS ================================= */
+
+#define BENCH_ITERATIONS    2000000UL
+#define BENCH_BUFFER_LEN    64U
+#define BENCH_MAX_FIELDS    48U
+
+/* ================================= STRUCTS ================================ */
+
+/**
+ * @brief Bit layout of one data item (widths in wire order)
+ */
+typedef struct BenchLayout
+{
+    const char * name;
+    size_t n_fields;
+    u8 widths[BENCH_MAX_FIELDS];
+} BenchLayout;
+
+typedef void (*BenchWrite)(BitStream * bs, u64 value, size_t n_bits);
+typedef u64  (*BenchRead)(BitStream * bs, size_t n_bits);
+
+/* ============================== REFERENCE ================================= */
+
+/* Kept out of line, as the library functions were, so both pay a call */
+#if defined(__GNUC__) || defined(__clang__)
+    #define BENCH_NOINLINE __attribute__((noinline))
+#else
+    #define BENCH_NOINLINE
+#endif
+
+BENCH_NOINLINE static void ref_serialize(BitStream * bs, u64 value, size_t n_bits)
+{
+    u8 bit = 0U;
+    size_t i = 0U;
+
+    for (i = 0; i < n_bits; ++i) {
+        bit = (value >> (n_bits - 1U - i)) & 1U;
+
+        bs->buffer[bs->byte_pos] &= ~(1U << (7U - bs->bit_pos));
+        bs->buffer[bs->byte_pos] |=  (bit << (7U - bs->bit_pos));
+
+        bs->bit_pos++;
+        if (bs->bit_pos == 8U) {
+            bs->bit_pos = 0U;
+            bs->byte_pos++;
+        }
+    }
+}
+
+BENCH_NOINLINE static u64 ref_deserialize(BitStream * bs, size_t nbits)
+{
+    u64 value = 0U;
+    size_t i = 0U;
+    u8 bit = 0U;
+
+    for (i = 0U; i < nbits; i++) {
+        bit = ((bs->buffer[bs->byte_pos]) >> (7U - bs->bit_pos)) & 1U;
+
+        value = (value << 1U) | bit;
+        bs->bit_pos++;
+        if (bs->bit_pos == 8U) {
+            bs->bit_pos = 0U;
+            bs->byte_pos++;
+        }
+    }
+
+    return value;
+}
+
+/* ================================ LAYOUTS ================================= */
+
+static const BenchLayout layouts[] = {
+    { "I034/010 SAC/SIC",     2U, { 8, 8 } },
+    { "I034/000 MSG TYPE",    1U, { 8 } },
+    { "I034/030 TOD",         1U, { 24 } },
+    { "I034/020 SECTOR",      1U, { 8 } },
+    { "I034/041 ANTROTSPD",   1U, { 16 } },
+    { "I034/050 (all sub.)", 28U, { 1, 2, 1, 1, 1, 1, 1,
+                                    1, 1, 1, 1, 1, 1, 1, 1,
+                                    1, 2, 1, 1, 3,
+                                    1, 2, 1, 1, 3,
+                                    1, 2, 1, 1 } },
+    { "I034/060 (all sub.)", 18U, { 1, 2, 1, 1, 1, 1, 1,
+                                    1, 3, 3, 1,
+                                    1, 3, 2, 2,
+                                    3, 5,
+                                    3 } },
+    { "I034/070 (REP=20)",   41U, { 8,
+                                    5, 11, 5, 11, 5, 11, 5, 11, 5, 11,
+                                    5, 11, 5, 11, 5, 11, 5, 11, 5, 11,
+                                    5, 11, 5, 11, 5, 11, 5, 11, 5, 11,
+                                    5, 11, 5, 11, 5, 11, 5, 11, 5, 11 } },
+    { "I034/100 POLAR WIN",   4U, { 16, 16, 16, 16 } },
+    { "I034/110 DATA FILTER", 1U, { 8 } },
+    { "I034/120 3D-POS",      3U, { 16, 24, 24 } },
+    { "I034/090 COLLIMATION", 2U, { 8, 8 } },
+};
+
+/* ================================ HELPERS ================================= */
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static u64 field_value(size_t i, u8 width)
+{
+    u64 v = 0x9E3779B97F4A7C15ULL * (u64)(i + 1U);
+    return (width < 64U) ? (v & ((1ULL << width) - 1U)) : v;
+}
+
+static void write_layout(BenchWrite write, u8 * buffer, const BenchLayout * l)
+{
+    BitStream bs;
+    size_t i = 0U;
+
+    bs_init(&bs, buffer, BENCH_BUFFER_LEN);
+    for (i = 0U; i < l->n_fields; i++) {
+        write(&bs, field_value(i, l->widths[i]), l->widths[i]);
+    }
+}
+
+static u64 read_layout(BenchRead read, u8 * buffer, const BenchLayout * l)
+{
+    BitStream bs;
+    u64 sum = 0U;
+    size_t i = 0U;
+
+    bs_init(&bs, buffer, BENCH_BUFFER_LEN);
+    for (i = 0U; i < l->n_fields; i++) {
+        sum += read(&bs, l->widths[i]);
+    }
+    return sum;
+}
+
+/* =========================== EQUIVALENCE CHECK ============================ */
+
+static int check_random_fields(void)
+{
+    u8 lib_buf[BENCH_BUFFER_LEN];
+    u8 ref_buf[BENCH_BUFFER_LEN];
+    size_t widths[BENCH_BUFFER_LEN * 8U];
+    BitStream lib_bs, ref_bs;
+    int round = 0;
+
+    srand(1U);
+    for (round = 0; round < 20000; round++) {
+        size_t size = 8U + ((size_t)rand() % (BENCH_BUFFER_LEN - 7U));
+        size_t bits = 3U * 8U;
+        size_t n_fields = 0U;
+        size_t i = 0U;
+
+        memset(lib_buf, 0xA5, sizeof(lib_buf));
+        memset(ref_buf, 0xA5, sizeof(ref_buf));
+        bs_init(&lib_bs, lib_buf, size);
+        bs_init(&ref_bs, ref_buf, size);
+
+        while (1) {
+            size_t n = (size_t)rand() % 65U;
+            u64 v = ((u64)rand() << 42U) ^ ((u64)rand() << 21U) ^ (u64)rand();
+
+            if (bits + n > size * 8U) {
+                break;
+            }
+            _bs_serialize(&lib_bs, v, n);
+            ref_serialize(&ref_bs, v, n);
+            widths[n_fields++] = n;
+            bits += n;
+        }
+        if (memcmp(lib_buf, ref_buf, sizeof(lib_buf)) != 0) {
+            return 0;
+        }
+
+        bs_init(&lib_bs, lib_buf, size);
+        bs_init(&ref_bs, ref_buf, size);
+        for (i = 0U; i < n_fields; i++) {
+            if (_bs_deserialize(&lib_bs, widths[i]) != ref_deserialize(&ref_bs, widths[i])) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* ================================== MAIN ================================== */
+
+int main(void)
+{
+    u8 lib_buf[BENCH_BUFFER_LEN];
+    u8 ref_buf[BENCH_BUFFER_LEN];
+    volatile u64 sink = 0U;
+    size_t n_layouts = sizeof(layouts) / sizeof(layouts[0]);
+    size_t i = 0U;
+    unsigned long it = 0UL;
+
+    if (!check_random_fields()) {
+        fprintf(stderr, "Engine output differs from the per-bit reference\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("%-22s %12s %12s %8s %12s %12s %8s\n", "item",
+           "enc ref ns", "enc lib ns", "gain",
+           "dec ref ns", "dec lib ns", "gain");
+
+    for (i = 0U; i < n_layouts; i++) {
+        const BenchLayout * l = &layouts[i];
+        double t0, t_enc_ref, t_enc_lib, t_dec_ref, t_dec_lib;
+
+        memset(lib_buf, 0, sizeof(lib_buf));
+        memset(ref_buf, 0, sizeof(ref_buf));
+        write_layout(_bs_serialize, lib_buf, l);
+        write_layout(ref_serialize, ref_buf, l);
+        if ((memcmp(lib_buf, ref_buf, sizeof(lib_buf)) != 0) ||
+            (read_layout(_bs_deserialize, lib_buf, l) != read_layout(ref_deserialize, ref_buf, l))) {
+            fprintf(stderr, "%s: engine output differs from the reference\n", l->name);
+            return EXIT_FAILURE;
+        }
+
+        t0 = now_ns();
+        for (it = 0UL; it < BENCH_ITERATIONS; it++) {
+            write_layout(ref_serialize, ref_buf, l);
+        }
+        t_enc_ref = (now_ns() - t0) / (double)BENCH_ITERATIONS;
+
+        t0 = now_ns();
+        for (it = 0UL; it < BENCH_ITERATIONS; it++) {
+            write_layout(_bs_serialize, lib_buf, l);
+        }
+        t_enc_lib = (now_ns() - t0) / (double)BENCH_ITERATIONS;
+
+        t0 = now_ns();
+        for (it = 0UL; it < BENCH_ITERATIONS; it++) {
+            sink += read_layout(ref_deserialize, ref_buf, l);
+        }
+        t_dec_ref = (now_ns() - t0) / (double)BENCH_ITERATIONS;
+
+        t0 = now_ns();
+        for (it = 0UL; it < BENCH_ITERATIONS; it++) {
+            sink += read_layout(_bs_deserialize, lib_buf, l);
+        }
+        t_dec_lib = (now_ns() - t0) / (double)BENCH_ITERATIONS;
+
+        printf("%-22s %12.2f %12.2f %7.1fx %12.2f %12.2f %7.1fx\n", l->name,
+               t_enc_ref, t_enc_lib, t_enc_ref / t_enc_lib,
+               t_dec_ref, t_dec_lib, t_dec_ref / t_dec_lib);
+    }
+
+    (void)sink;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file FSPEC.h
+ * @brief Field Specification (FSPEC) of ASTERIX records
+ * @version 0.1
+ * @date 2026-03-21
+ * 
+ * @copyright Copyright (c) 2026
+ */
+#ifndef FSPEC_H
+#define FSPEC_H
+
+/* Project libraries */
+#include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Common/common_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= STRUCTS ================================= */
+
+/**
+ * @typedef FSPEC
+ * @brief Field Specification of an ASTERIX record
+ * 
+ * Presence of the data items as a mask where bit (FRN - 1) is set for every
+ * present item. The FX bits are not stored: the FSPEC is always written with
+ * the octets needed by the items present, and the number of octets is given
+ * by fspec_octets().
+ */
+typedef struct FSPEC
+{
+    /// @brief Presence mask (bit FRN - 1)
+    u64 present;
+} FSPEC;
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/// @brief Presence of the item with the given FRN (1-based)
+static inline ePresenceFlag fspec_get(const FSPEC *fspec, size_t frn)
+{
+    return ((fspec->present & UAP_FRN_BIT(frn)) != 0U) ? ePresenceFlag_PRESENT : ePresenceFlag_ABSENT;
+}
+
+/// @brief Mark the item with the given FRN (1-based) as present
+static inline void fspec_set(FSPEC *fspec, size_t frn)
+{
+    fspec->present |= UAP_FRN_BIT(frn);
+}
+
+/// @brief Mark the item with the given FRN (1-based) as absent
+static inline void fspec_clear(FSPEC *fspec, size_t frn)
+{
+    fspec->present &= ~UAP_FRN_BIT(frn);
+}
+
+/// @brief Set the presence of the item with the given FRN (1-based)
+static inline void fspec_put(FSPEC *fspec, size_t frn, ePresenceFlag flag)
+{
+    if (flag == ePresenceFlag_PRESENT)
+        fspec_set(fspec, frn);
+    else
+        fspec_clear(fspec, frn);
+}
+
+/// @brief Number of items present
+static inline size_t fspec_count(const FSPEC *fspec)
+{
+    return uap_popcount64(fspec->present);
+}
+
+/// @brief Number of octets of the FSPEC on the wire
+static inline size_t fspec_octets(const FSPEC *fspec)
+{
+    return uap_fspec_octets(fspec->present);
+}
+
+/**
+ * @brief Lowest FRN present in *mask, which is removed from it (0 when no
+ * item is left)
+ *
+ * Iterates over the present items only:
+ * `for (m = fspec.present; (frn = fspec_next(&m)) != 0U;) { ... }`
+ */
+static inline size_t fspec_next(u64 *mask)
+{
+    size_t frn = 0U;
+
+    if (*mask == 0U)
+        return 0U;
+    frn = uap_ctz64(*mask) + 1U;
+    *mask &= *mask - 1U;
+    return frn;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FSPEC_H */
@@ -15,7 +15,12 @@ extern "C" {
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Infra/block.h>
+#include <Infra/field.h>
+#include <Categories/Registry.h>
 #include <Categories/Header.h>
+#include <Categories/FSPEC.h>
 #include <Categories/SAC_SIC.h>
 #include <Common/common_types.h>
 
@@ -33,39 +38,71 @@ extern "C" {
 #include <Categories/I034/I034_090.h>
 #include <Categories/I034/I034_RE.h>
 #include <Categories/I034/I034_SP.h>
+#include <Categories/I034/I034_config.h>
 
 /* ================================= ENUMS ================================= */
 
 /* ================================= MACROS ================================= */
 
+/**
+ * Field-style access to the FSPEC of a record, by item name:
+ * `I034_FSPEC_SET(&rec.FSPEC, I034_010)`, `I034_FSPEC_GET(&rec.FSPEC, I034_RE)`
+ */
+#define I034_FSPEC_GET(FSPEC_PTR, ITEM)             fspec_get((FSPEC_PTR), eI034_FRN_##ITEM)
+#define I034_FSPEC_SET(FSPEC_PTR, ITEM)             fspec_set((FSPEC_PTR), eI034_FRN_##ITEM)
+#define I034_FSPEC_CLEAR(FSPEC_PTR, ITEM)           fspec_clear((FSPEC_PTR), eI034_FRN_##ITEM)
+#define I034_FSPEC_PUT(FSPEC_PTR, ITEM, FLAG)       fspec_put((FSPEC_PTR), eI034_FRN_##ITEM, (FLAG))
+
+/// @brief Number of FRNs of the Category 034 UAP
+#define I034_FRN_COUNT                              14U
+
+/**
+ * Item masks of the selective decoders (see decode_I034_masked()):
+ * `I034_MASK(I034_010) | I034_MASK(I034_030)`
+ */
+#define I034_MASK(ITEM)                             UAP_FRN_BIT(eI034_FRN_##ITEM)
+#define I034_MASK_ALL                               UAP_FRN_UPTO(I034_FRN_COUNT)
+
+/**
+ * Location of an item in an I034_Index, by item name:
+ * `I034_INDEX_ITEM(&idx, I034_030)->offset` (frn is 0 if absent)
+ */
+#define I034_INDEX_ITEM(INDEX_PTR, NAME)            (&(INDEX_PTR)->ITEM[eI034_FRN_##NAME - 1])
+
+/* ================================= ENUMS ================================= */
+
+/**
+ * @brief Field Reference Number (FRN) of the Category 034 data items
+ */
+typedef enum eI034_FRN
+{
+    eI034_FRN_I034_010 =  1, /* I034/010 - Data Source Identifier */
+    eI034_FRN_I034_000 =  2, /* I034/000 - Message Type */
+    eI034_FRN_I034_030 =  3, /* I034/030 - Time-of-Day */
+    eI034_FRN_I034_020 =  4, /* I034/020 - Sector Number */
+    eI034_FRN_I034_041 =  5, /* I034/041 - Antenna Rotation Speed */
+    eI034_FRN_I034_050 =  6, /* I034/050 - System Configuration and Status */
+    eI034_FRN_I034_060 =  7, /* I034/060 - System Processing Mode */
+    eI034_FRN_I034_070 =  8, /* I034/070 - Message Count Values */
+    eI034_FRN_I034_100 =  9, /* I034/100 - Generic Polar Filter */
+    eI034_FRN_I034_110 = 10, /* I034/110 - Data Filter */
+    eI034_FRN_I034_120 = 11, /* I034/120 - 3D-Position of Data Source  */
+    eI034_FRN_I034_090 = 12, /* I034/090 - Colimation Error */
+    eI034_FRN_I034_RE  = 13, /* I034/RE - Reserved Expansion Field */
+    eI034_FRN_I034_SP  = 14, /* I034/SP - Special Purpose Field */
+} eI034_FRN;
+
 /* ================================= STRUCT ================================= */
 
- /**
+/**
  * @typedef I034_FSPEC
- * @brief FSPEC of Category 034 messages
- * 
- * Field Specification Type of CAT034 messages
+ * @brief FSPEC of Category 034 messages (bit FRN - 1 set for present items)
+ *
+ * See eI034_FRN and the I034_FSPEC_* macros, which replace the per-item
+ * ePresenceFlag members of previous versions (not source compatible: see the
+ * README).
  */
-typedef struct I034_FSPEC
-{
-    ePresenceFlag I034_010; /* I034/010 - Data Source Identifier */
-    ePresenceFlag I034_000; /* I034/000 - Message Type */
-    ePresenceFlag I034_030; /* I034/030 - Time-of-Day */
-    ePresenceFlag I034_020; /* I034/020 - Sector Number */
-    ePresenceFlag I034_041; /* I034/041 - Antenna Rotation Speed */
-    ePresenceFlag I034_050; /* I034/050 - System Configuration and Status */
-    ePresenceFlag I034_060; /* I034/060 - System Processing Mode */
-    ePresenceFlag FX_1;     /* FX - Field Extension */
-
-    ePresenceFlag I034_070; /* I034/070 - Message Count Values */
-    ePresenceFlag I034_100; /* I034/100 - Generic Polar Filter */
-    ePresenceFlag I034_110; /* I034/110 - Data Filter */
-    ePresenceFlag I034_120; /* I034/120 - 3D-Position of Data Source  */
-    ePresenceFlag I034_090; /* I034/090 - Colimation Error */
-    ePresenceFlag I034_RE;  /* I034/RE - Reserved Expansion Field */
-    ePresenceFlag I034_SP;  /* I034/SP - Special Purpose Field */
-    ePresenceFlag FX_2;     /* FX - Field Extension */
-} I034_FSPEC;
+typedef FSPEC I034_FSPEC;
 
 /**
 * @typedef I034
@@ -98,21 +135,337 @@ typedef struct I034
     I034_SP     I034_SP;
 } I034;
 
+/**
+* @typedef I034_Index
+* @brief Location of the items of a Category 034 record in its raw octets
+*
+* Filled by index_I034() from the FSPEC and the item lengths only, so
+* consumers interested in a few items (e.g. I034/000 and I034/030) can decode
+* or forward those alone. Offsets are counted from the first octet (CAT) of
+* the data block.
+*/
+typedef struct I034_Index
+{
+    Header      HEADER;
+    I034_FSPEC  FSPEC;
+    /// @brief Length of the record in octets (Header, FSPEC and items)
+    u16         record_len;
+    /// @brief Location of each item, indexed by FRN - 1 (see I034_INDEX_ITEM)
+    UapItemRef  ITEM[I034_FRN_COUNT];
+} I034_Index;
+
+/**
+* @typedef I034_View
+* @brief Read-only view of a raw Category 034 message
+*
+* Holds the raw octets of the data block (which are never copied nor
+* modified) and the location of its items. Each item is only decoded when
+* its view_I034_xxx() accessor is called, into the same item structures used
+* by decode_I034(), so consumers of a few fields do not pay for the rest.
+*
+* @note The raw octets must outlive the view
+*/
+typedef struct I034_View
+{
+    /// @brief First octet (CAT) of the raw data block
+    const u8 *  data;
+    /// @brief Header, FSPEC and item locations of the record
+    I034_Index  index;
+} I034_View;
+
+/**
+ * Presence of an item in an I034_View, by item name:
+ * `I034_VIEW_HAS(&view, I034_030)`
+ */
+#define I034_VIEW_HAS(VIEW_PTR, NAME)               (I034_INDEX_ITEM(&(VIEW_PTR)->index, NAME)->frn != 0U)
+
+/**
+* @typedef I034_Visitor
+* @brief Per-item callbacks of visit_I034()
+*
+* Each present item is decoded into a stack temporary and handed to its
+* callback together with ctx; the item is only valid during the call.
+* Items whose callback is NULL are skipped without being decoded.
+*/
+typedef struct I034_Visitor
+{
+    /// @brief User context passed to every callback
+    void *  ctx;
+    void    (*on_I034_010)(void *ctx, const I034_010 *item);
+    void    (*on_I034_000)(void *ctx, const I034_000 *item);
+    void    (*on_I034_030)(void *ctx, const I034_030 *item);
+    void    (*on_I034_020)(void *ctx, const I034_020 *item);
+    void    (*on_I034_041)(void *ctx, const I034_041 *item);
+    void    (*on_I034_050)(void *ctx, const I034_050 *item);
+    void    (*on_I034_060)(void *ctx, const I034_060 *item);
+    void    (*on_I034_070)(void *ctx, const I034_070 *item);
+    void    (*on_I034_100)(void *ctx, const I034_100 *item);
+    void    (*on_I034_110)(void *ctx, const I034_110 *item);
+    void    (*on_I034_120)(void *ctx, const I034_120 *item);
+    void    (*on_I034_090)(void *ctx, const I034_090 *item);
+    void    (*on_I034_RE)(void *ctx, const I034_RE *item);
+    void    (*on_I034_SP)(void *ctx, const I034_SP *item);
+} I034_Visitor;
+
+/**
+ * @brief User Application Profile of Category 034 (items indexed by FRN - 1)
+ */
+ASTERIX_LIB extern const Uap I034_UAP;
+
+/**
+ * @brief Codecs of Category 034, registered for CAT 034 (see asterix_category())
+ */
+ASTERIX_LIB extern const AsterixCategory I034_CATEGORY;
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode the Category 034 message (Header, FSPEC and data items) into a raw ASTERIX message.
+ * 
+ * The FSPEC is written with the octets needed by the present items only, and
+ * the items follow in FRN order as described by I034_UAP. Each item is checked
+ * once against the size of the buffer before being written; the header is
+ * only written if the whole record fits.
  * 
  * @param[in/out] bs Pointer to the BitStream (must not be NULL)
  * @param[in] item Pointer to the I034 structure (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus encode_I034(BitStream * bs, const I034 * item);
+
+/** @brief Length in octets of the Category 034 message once encoded, without encoding it.
+ *
+ * Computed from the FSPEC and the structures of the variable-length items
+ * (see encoded_size_I034_xxx()), e.g. to reserve the exact space of the
+ * message in a ring buffer before encoding it.
+ *
+ * @param[in] item Pointer to the I034 structure (must not be NULL)
+ * @return Length of the data block holding the record (header included), or
+ * 0 if the FSPEC references items beyond the UAP
  */
-ASTERIX_LIB void encode_I034(BitStream * bs, const I034 * item);
+ASTERIX_LIB size_t encoded_size_I034(const I034 * item);
+
+/** @brief Length in octets of one Category 034 record once encoded, without the block header.
+ *
+ * Record-level counterpart of encoded_size_I034(), e.g. to check that a
+ * record still fits in an open data block before appending it with
+ * encode_I034(), which extends LEN over it.
+ *
+ * @param[in] item Pointer to the I034 structure (must not be NULL)
+ * @return Length of the FSPEC and of the present items, or 0 if the FSPEC
+ * references items beyond the UAP
+ */
+ASTERIX_LIB size_t encoded_size_I034_record(const I034 * item);
 
 /** @brief Decode the Category 034 message (Header, FSPEC and data items) from a raw ASTERIX message.
+ * 
+ * LEN is validated once against the size of the buffer, and each item
+ * against LEN before being decoded, so the BitStream can be built directly
+ * over a receive buffer: a truncated or inconsistent block is reported
+ * without reading past it.
  * 
  * @param[in/out] bs Pointer to the BitStream (must not be NULL)
  * @param[in/out] item Pointer to the I034 structure (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus decode_I034(BitStream * bs, I034 * item);
+
+/** @brief Decode the items of a Category 034 message that are in mask, skipping the others.
+ *
+ * Same as decode_I034(), but the present items outside mask are only
+ * measured and skipped, not decoded, and are cleared from item->FSPEC: the
+ * result holds exactly the items that were both present and wanted. Their
+ * fields in item are left untouched.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[out] item Pointer to the I034 structure (must not be NULL)
+ * @param[in] mask Items to decode, e.g. I034_MASK(I034_010) | I034_MASK(I034_020)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus decode_I034_masked(BitStream * bs, I034 * item, u64 mask);
+
+/** @brief Decode one record (FSPEC and data items) of a Category 034 data block.
+ *
+ * The record is read at the current position of the BitStream, e.g. past
+ * the previous record of the block or at an offset reported by
+ * record_iter_next() (see bs_init_at()). The header of the block is copied
+ * into item->HEADER but not validated: that is done once per block, by
+ * decode_I034() or decode_I034_batch().
+ *
+ * @param[in/out] bs Pointer to the BitStream, positioned on the record (must not be NULL)
+ * @param[out] item Pointer to the I034 structure (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus decode_I034_record(BitStream * bs, I034 * item);
+
+/** @brief Decode the items in mask of one record of a Category 034 data block.
+ *
+ * Record-level counterpart of decode_I034_masked() (see decode_I034_record()).
+ *
+ * @param[in/out] bs Pointer to the BitStream, positioned on the record (must not be NULL)
+ * @param[out] item Pointer to the I034 structure (must not be NULL)
+ * @param[in] mask Items to decode (see I034_MASK())
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus decode_I034_record_masked(BitStream * bs, I034 * item, u64 mask);
+
+/** @brief Decode up to n_items records of a Category 034 data block in one call.
+ *
+ * The header is validated, then records are decoded from the current
+ * position until the end of the block, n_items records or the first error.
+ * A block holding more records is finished by calling it again with the
+ * same BitStream, which resumes after the last record decoded.
+ *
+ * @param[in/out] bs Pointer to the BitStream over the data block (must not be NULL)
+ * @param[out] items Array of at least n_items I034 structures (must not be NULL)
+ * @param[in] n_items Max. number of records to decode
+ * @return Number of records decoded; on error, bs_status() tells why the
+ * next one could not be
+ */
+ASTERIX_LIB size_t decode_I034_batch(BitStream * bs, I034 * items, size_t n_items);
+
+/** @brief Decode the items in mask of up to n_items records of a Category 034 data block.
+ *
+ * Batch counterpart of decode_I034_masked() (see decode_I034_batch()).
+ *
+ * @param[in/out] bs Pointer to the BitStream over the data block (must not be NULL)
+ * @param[out] items Array of at least n_items I034 structures (must not be NULL)
+ * @param[in] n_items Max. number of records to decode
+ * @param[in] mask Items to decode (see I034_MASK())
+ * @return Number of records decoded (see decode_I034_batch())
+ */
+ASTERIX_LIB size_t decode_I034_batch_masked(BitStream * bs, I034 * items, size_t n_items, u64 mask);
+
+/** @brief Move the BitStream past one record of a Category 034 data block without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream, positioned on the record (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus skip_I034_record(BitStream * bs);
+
+/** @brief Locate the data items of a Category 034 message without decoding them.
+ *
+ * The Header and FSPEC are read as in decode_I034(), then each present item
+ * is measured from its raw octets and skipped (see length_I034_xxx()), so
+ * that a single item can be decoded afterwards by positioning the BitStream
+ * at its offset.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[out] index Pointer to the I034_Index structure (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus index_I034(BitStream * bs, I034_Index * index);
+
+/** @brief Decode a Category 034 message item by item into the callbacks of a visitor.
+ *
+ * Same checks as decode_I034(), but no I034 structure is filled: the working
+ * set is a single item at a time, which suits converters and forwarders.
+ * Callbacks are called in FRN order, only for the items present.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] visitor Pointer to the callbacks (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
  */
-ASTERIX_LIB void decode_I034(BitStream * bs, I034 * item);
+ASTERIX_LIB eAsterixStatus visit_I034(BitStream * bs, const I034_Visitor * visitor);
+
+/** @brief Visit the items of a Category 034 record from the current position.
+ *
+ * The item loop of visit_I034(), for callers that have read the FSPEC (and
+ * possibly some leading items) themselves.
+ *
+ * @param[in/out] bs Pointer to the BitStream, on the first item to visit (must not be NULL)
+ * @param[in] visitor Pointer to the callbacks (must not be NULL)
+ * @param[in] present Presence mask of the items left (bit FRN - 1)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus visit_I034_items(BitStream * bs, const I034_Visitor * visitor, u64 present);
+
+/** @brief Build a lazy view over the raw octets of a Category 034 message.
+ *
+ * The block is validated and its items located as in index_I034(); nothing
+ * is decoded. Items are then read on demand with the view_I034_xxx() accessors.
+ *
+ * @param[out] view Pointer to the I034_View structure (must not be NULL)
+ * @param[in] data First octet (CAT) of the data block (must not be NULL)
+ * @param[in] size Number of octets available at data
+ * @return eAsterixStatus_OK, or the first error found in the block
+ */
+ASTERIX_LIB eAsterixStatus view_I034(I034_View * view, const u8 * data, size_t size);
+
+/**
+ * @brief Decode one item of an I034_View, straight from the raw octets.
+ *
+ * `eBoolean view_I034_xxx(const I034_View * view, I034_xxx * item)` returns
+ * eBoolean_TRUE and fills item if the item is present in the record, or
+ * eBoolean_FALSE leaving item untouched. The item was already checked against
+ * the block by view_I034(), so decoding it cannot fail. Only the items built
+ * have an accessor (see I034_config.h).
+ */
+#define I034_VIEW_ACCESSOR(ID) I034_IF(ID, I034_VIEW_ACCESSOR_(ID))
+#define I034_VIEW_ACCESSOR_(ID) \
+    ASTERIX_LIB eBoolean view_I034_##ID(const I034_View * view, I034_##ID * item);
+
+I034_VIEW_ACCESSOR(010)
+I034_VIEW_ACCESSOR(000)
+I034_VIEW_ACCESSOR(030)
+I034_VIEW_ACCESSOR(020)
+I034_VIEW_ACCESSOR(041)
+I034_VIEW_ACCESSOR(050)
+I034_VIEW_ACCESSOR(060)
+I034_VIEW_ACCESSOR(070)
+I034_VIEW_ACCESSOR(100)
+I034_VIEW_ACCESSOR(110)
+I034_VIEW_ACCESSOR(120)
+I034_VIEW_ACCESSOR(090)
+I034_VIEW_ACCESSOR(RE)
+I034_VIEW_ACCESSOR(SP)
+
+#undef I034_VIEW_ACCESSOR
+#undef I034_VIEW_ACCESSOR_
+
+/* ================================= FIELDS ================================= */
+
+/**
+ * @brief Field metadata of the Category 034 items, indexed by FRN - 1
+ *
+ * NULL for the items without fields (I034/RE, I034/SP and the items
+ * compiled out, see I034_config.h).
+ */
+ASTERIX_LIB extern const FieldItem *const I034_FIELDS[I034_FRN_COUNT];
+
+/** @brief Compile the path of a Category 034 field into an accessor (see field.h).
+ *
+ * @param[out] acc Accessor (must not be NULL)
+ * @param[in] path Field path, e.g. "I034/050.ext1.OVLRDP", "I034/120.LATWGS84"
+ * or "I034/070[0].COUNTER" (must not be NULL)
+ * @return eAsterixStatus_OK, or eAsterixStatus_ERR_FIELD if the path names no field
+ */
+ASTERIX_LIB eAsterixStatus compile_I034_field(FieldAccessor * acc, const char * path);
+
+/** @brief Read a field of the record of an I034_View, straight from the raw octets.
+ *
+ * @param[in] view View built by view_I034() (must not be NULL)
+ * @param[in] acc Accessor compiled by compile_I034_field() (must not be NULL)
+ * @param[out] raw Raw value of the field (count of LSB or code point, see
+ * field_value() and field_label())
+ * @return eBoolean_TRUE, or eBoolean_FALSE leaving raw untouched if the
+ * record does not hold the field
+ */
+static inline eBoolean read_I034_field(const I034_View * view, const FieldAccessor * acc, s64 * raw)
+{
+    return field_read(acc, view->data, view->index.ITEM, raw);
+}
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/** @brief Print the Header and the present data items of a Category 034 message.
+ *
+ * Not built with I034_WITH_PRINT set to 0 (see I034_config.h).
+ *
+ * @param item Pointer to the I034 structure.
+ */
+#if I034_WITH_PRINT
+ASTERIX_LIB void print_I034(const I034 * item);
+#endif
 
 #ifdef __cplusplus
 }
@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 #include <Common/versions.h>
 
@@ -24,21 +25,22 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_000_LEN            1U
+
 /* ================================= ENUMS ================================= */
 
+/* The types of every supported edition are defined; the ones a given source
+ * may send are those of its edition (see I034_Edition) */
 typedef enum eI034_000_MSG_TYPE
 {
     eI034_000_MSG_TYPE_NORTH_MARKER = 1,
     eI034_000_MSG_TYPE_SECTOR_CROSSING,
     eI034_000_MSG_TYPE_GEO_FILTERING,
     eI034_000_MSG_TYPE_JAMMING_STROBE,
-#if ((EDITION_NUMBER_I034 >= 1) && (VERSION_NUMBER_I034 >= 28))
-    eI034_000_MSG_TYPE_SOLAR_STORM,
-#endif
-#if ((EDITION_NUMBER_I034 >= 1) && (VERSION_NUMBER_I034 >= 29))
-    eI034_000_MSG_TYPE_SSR_JAMMING_STROBE,
-    eI034_000_MSG_TYPE_MS_JAMMING_STROBE,
-#endif
+    eI034_000_MSG_TYPE_SOLAR_STORM,         /* Edition 1.28 and later */
+    eI034_000_MSG_TYPE_SSR_JAMMING_STROBE,  /* Edition 1.29 and later */
+    eI034_000_MSG_TYPE_MS_JAMMING_STROBE,   /* Edition 1.29 and later */
 } eI034_000_MSG_TYPE;
 
 /* ================================= STRUCTS ================================= */
@@ -76,6 +78,38 @@ ASTERIX_LIB void encode_I034_000(BitStream *bs, const I034_000 *item);
  */
 ASTERIX_LIB void decode_I034_000(BitStream *bs, I034_000 *item);
 
+/** @brief Decode item I034/000 (Message Type) from its raw octets.
+ *
+ * @param[in] raw The I034_000_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_000 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_000(const u8 *raw, I034_000 *item);
+
+/** @brief Length in octets of the data item I034/000 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_000_LEN)
+ */
+ASTERIX_LIB size_t length_I034_000(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/000 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_000 structure (must not be NULL)
+ * @return Length of the item (I034_000_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_000(const I034_000 *item);
+
+/** @brief Move the BitStream past the data item I034/000 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_000(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/000 (Message Type), see field.h */
+ASTERIX_LIB extern const FieldItem I034_000_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /**
@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 #include <Categories/SAC_SIC.h>
 
@@ -24,6 +25,9 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_010_LEN            2U
+
 /* ================================= ENUMS ================================= */
 
 /* ================================= STRUCTS ================================= */
@@ -56,6 +60,38 @@ ASTERIX_LIB void encode_I034_010(BitStream *bs, const I034_010 *item);
  */
 ASTERIX_LIB void decode_I034_010(BitStream *bs, I034_010 *item);
 
+/** @brief Decode item I034/010 (Data source Identification) from its raw octets.
+ *
+ * @param[in] raw The I034_010_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_010 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_010(const u8 *raw, I034_010 *item);
+
+/** @brief Length in octets of the data item I034/010 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_010_LEN)
+ */
+ASTERIX_LIB size_t length_I034_010(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/010 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_010 structure (must not be NULL)
+ * @return Length of the item (I034_010_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_010(const I034_010 *item);
+
+/** @brief Move the BitStream past the data item I034/010 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_010(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/010 (Data Source Identification), see field.h */
+ASTERIX_LIB extern const FieldItem I034_010_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /**
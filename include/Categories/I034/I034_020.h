@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 
 #ifdef __cplusplus
@@ -23,11 +24,17 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_020_LEN            1U
+
 /**
  * @brief Sector Number LSB = 360/2^8 degrees
  */
 #define I034_020_LSB_SECTNUM (1.40625F)
 
+/// @brief Sector Number raw LSB counts per degree (1/LSB)
+#define I034_020_SCALE_SECTNUM (256.0 / 360.0)
+
 /* ================================= ENUMS ================================= */
 
 /* ================================= STRUCTS ================================= */
@@ -45,9 +52,14 @@ typedef struct I034_020
      * 
      * LSB = 360/2^8 degrees
      */
-    float SECTAZ;
+    ASTERIX_SCALED(u8) SECTAZ;
 } I034_020;
 
+/* =============================== ACCESSORS =============================== */
+
+/// @brief get/set the sector azimuth (degrees, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_020, SECTAZ, u8, I034_020_LSB_SECTNUM, I034_020_SCALE_SECTNUM)
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode the data item I034/020 (Sector Number) into a raw ASTERIX message.
@@ -64,6 +76,38 @@ ASTERIX_LIB void encode_I034_020(BitStream *bs, const I034_020 *item);
  */
 ASTERIX_LIB void decode_I034_020(BitStream *bs, I034_020 *item);
 
+/** @brief Decode item I034/020 (Sector Number) from its raw octets.
+ *
+ * @param[in] raw The I034_020_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_020 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_020(const u8 *raw, I034_020 *item);
+
+/** @brief Length in octets of the data item I034/020 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_020_LEN)
+ */
+ASTERIX_LIB size_t length_I034_020(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/020 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_020 structure (must not be NULL)
+ * @return Length of the item (I034_020_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_020(const I034_020 *item);
+
+/** @brief Move the BitStream past the data item I034/020 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_020(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/020 (Sector Number), see field.h */
+ASTERIX_LIB extern const FieldItem I034_020_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /** @brief Print the contents of item 034/020 data item.
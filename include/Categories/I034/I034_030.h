@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 
 #ifdef __cplusplus
@@ -23,11 +24,17 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_030_LEN            3U
+
 /**
  * @brief Time of the Dat LSB = 1/128
  */
 #define I034_030_LSB_TOD    (0.0078125F)
 
+/// @brief Time of Day raw LSB counts per second (1/LSB)
+#define I034_030_SCALE_TOD  (128.0)
+
 /* ================================= ENUMS ================================= */
 
 /* ================================= STRUCTS ================================= */
@@ -45,9 +52,14 @@ typedef struct I034_030
      * 
      * LSB = 1/128 seconds
      */
-    float TOD;
+    ASTERIX_SCALED(u32) TOD;
 } I034_030;
 
+/* =============================== ACCESSORS =============================== */
+
+/// @brief get/set the time of day (seconds, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_030, TOD, u32, I034_030_LSB_TOD, I034_030_SCALE_TOD)
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode data item I034/030 (Time of Day) into a raw ASTERIX message.
@@ -64,6 +76,38 @@ ASTERIX_LIB void encode_I034_030(BitStream *bs, const I034_030 *item);
  */
 ASTERIX_LIB void decode_I034_030(BitStream *bs, I034_030 *item);
 
+/** @brief Decode item I034/030 (Time of Day) from its raw octets.
+ *
+ * @param[in] raw The I034_030_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_030 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_030(const u8 *raw, I034_030 *item);
+
+/** @brief Length in octets of the data item I034/030 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_030_LEN)
+ */
+ASTERIX_LIB size_t length_I034_030(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/030 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_030 structure (must not be NULL)
+ * @return Length of the item (I034_030_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_030(const I034_030 *item);
+
+/** @brief Move the BitStream past the data item I034/030 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_030(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/030 (Time of Day), see field.h */
+ASTERIX_LIB extern const FieldItem I034_030_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /** @brief Print the contents of item given 034/030 data item.
@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 
 #ifdef __cplusplus
@@ -23,11 +24,17 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_041_LEN            2U
+
 /**
  * @brief Antenna Rotation Speed LSB = 1/128 seconds
  */
 #define I034_042_LSB_ANTROTSPD (0.0078125F)
 
+/// @brief Antenna Rotation Speed raw LSB counts per second (1/LSB)
+#define I034_041_SCALE_ANTROTSPD (128.0)
+
 /* ================================= ENUMS ================================= */
 
 /* ================================= STRUCTS ================================= */
@@ -46,9 +53,14 @@ typedef struct I034_041
      * 
      * LSB = 1/128 seconds
      */
-    float ANTROTSPD;
+    ASTERIX_SCALED(u16) ANTROTSPD;
 } I034_041;
 
+/* =============================== ACCESSORS =============================== */
+
+/// @brief get/set the antenna rotation period (seconds, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_041, ANTROTSPD, u16, I034_042_LSB_ANTROTSPD, I034_041_SCALE_ANTROTSPD)
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode item I034/041 (Antenna Rotation Speed) into a raw ASTERIX message.
@@ -65,6 +77,38 @@ ASTERIX_LIB void encode_I034_041(BitStream *bs, const I034_041 *item);
  */
 ASTERIX_LIB void decode_I034_041(BitStream *bs, I034_041 *item);
 
+/** @brief Decode item I034/041 (Antenna Rotation Speed) from its raw octets.
+ *
+ * @param[in] raw The I034_041_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_041 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_041(const u8 *raw, I034_041 *item);
+
+/** @brief Length in octets of the data item I034/041 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_041_LEN)
+ */
+ASTERIX_LIB size_t length_I034_041(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/041 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_041 structure (must not be NULL)
+ * @return Length of the item (I034_041_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_041(const I034_041 *item);
+
+/** @brief Move the BitStream past the data item I034/041 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_041(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/041 (Antenna Rotation Speed), see field.h */
+ASTERIX_LIB extern const FieldItem I034_041_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /** @brief Print the contents of given I034/041 data item.
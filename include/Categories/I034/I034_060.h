@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 #include <Common/common_types.h>
 
@@ -162,6 +163,32 @@ ASTERIX_LIB void encode_I034_060(BitStream *bs, const I034_060 *item);
  */
 ASTERIX_LIB void decode_I034_060(BitStream *bs, I034_060 *item);
 
+/** @brief Length in octets of the data item I034/060 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item, read from its first octet, or 0 if the item
+ * is not within the data (see bs_status())
+ */
+ASTERIX_LIB size_t length_I034_060(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/060 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_060 structure (must not be NULL)
+ * @return Length of the primary subfield and of the present subfields
+ */
+ASTERIX_LIB size_t encoded_size_I034_060(const I034_060 *item);
+
+/** @brief Move the BitStream past the data item I034/060 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_060(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/060 (System Processing Mode), see field.h */
+ASTERIX_LIB extern const FieldItem I034_060_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /** @brief Print the contents of given 034/060 data item.
@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 #include <Common/versions.h>
 
@@ -26,8 +27,22 @@ extern "C" {
 /// @brief Max. number of Message Count Values (change as needed)
 #define I034_070_MAX_REP                255
 
+/// @brief Length of the data item in octets for a given repetition factor
+#define I034_070_LEN(REP)               (1U + (2U * (size_t)(REP)))
+
+/// @brief Message type (TYP) of a counter word (TYP on 5 bits, COUNTER on 11 bits)
+#define I034_070_WORD_TYP(WORD)         ((eI034_070_TYP)((WORD) >> 11U))
+
+/// @brief Counter value of a counter word
+#define I034_070_WORD_COUNTER(WORD)     ((u16)((WORD) & 0x07FFU))
+
+/// @brief Counter word of a message type and counter value
+#define I034_070_WORD(TYP, COUNTER)     ((u16)((((u16)(TYP) & 0x1FU) << 11U) | ((u16)(COUNTER) & 0x07FFU)))
+
 /* ================================= ENUMS ================================= */
 
+/* Counter types added by later editions are always defined: check them
+ * against the edition of the source with validate_I034() */
 typedef enum eI034_070_TYP
 {
     eI034_070_TYP_MISSES = 0,           /* No detection (number of misses) */
@@ -47,16 +62,25 @@ typedef enum eI034_070_TYP
     eI034_070_TYP_FIL_PSR_ENHS,         /* Filter for PSR+Enhanced Surveillance */
     eI034_070_TYP_FIL_PSR_ENHS_SSRMS,   /* Filter for PSR+Enhanced Surveillance + SSR/Mode S data not in Area of Prime Interest */
     eI034_070_TYP_FIL_PSR_ENHS_MS,      /* Filter for PSR+Enhanced Surveillance + all SSR/Mode S data */
-#if ((EDITION_NUMBER_I034 >= 1) && (VERSION_NUMBER_I034 >= 28))
-    eI034_070_TYP_REINT,                /* Re-Interrogations (per sector) */
-    eI034_070_TYP_BDSSWAP_WRONGDFREP,   /* BDS Swap and wrong DF replies (per sector) */
-    eI034_070_TYP_MODEAC_FRUIT,         /* Mode A/C FRUIT (per sector) */
-    eI034_070_TYP_MS_FRUIT,             /* Mode S FRUIT (per sector) */
-#endif
+    eI034_070_TYP_REINT,                /* Re-Interrogations (per sector), edition 1.28 and later */
+    eI034_070_TYP_BDSSWAP_WRONGDFREP,   /* BDS Swap and wrong DF replies (per sector), edition 1.28 and later */
+    eI034_070_TYP_MODEAC_FRUIT,         /* Mode A/C FRUIT (per sector), edition 1.28 and later */
+    eI034_070_TYP_MS_FRUIT,             /* Mode S FRUIT (per sector), edition 1.28 and later */
 } eI034_070_TYP;
 
 /* ================================= STRUCTS ================================= */
 
+/**
+ * @brief One Message Count Value of I034/070
+ */
+typedef struct I034_070_COUNTER
+{
+    /// @brief Type of message counter
+    eI034_070_TYP TYP;
+    /// @brief 11-bit counter value
+    u16 COUNTER;
+} I034_070_COUNTER;
+
 /**
  * @typedef I034_070
  * @brief Data Item 034/070 - Message Count Values
@@ -64,21 +88,84 @@ typedef enum eI034_070_TYP
  * Message Count values, according the various types of messages. The values
  * are collected for the last completed antenna revolution, counted between two
  * North crossings unless otherwise stated in the TYP definition below.
+ *
+ * The REP counters are not copied into the structure: RAW points to them as
+ * on the wire (one big-endian counter word each), in the decoded buffer or in
+ * the arena of the BitStream (see AsterixArena), and they are unpacked on
+ * demand with get_I034_070_COUNTER() or an I034_070_Iter. To encode, RAW
+ * points to 2 * REP octets filled with set_I034_070_COUNTER().
  */
 typedef struct I034_070
 {
     /// @brief Repetition Factor of counters following
     u8 REP;
-
-    struct COUNTER
-    {
-        /// @brief Type of message counter
-        eI034_070_TYP TYP;
-        /// @brief 11-bit counter value
-        u16 COUNTER;
-    } COUNTER[I034_070_MAX_REP];
+    /// @brief REP counter words (2 octets each, big-endian), NULL if REP is 0
+    const u8 * RAW;
 } I034_070;
 
+/**
+ * @brief Iterator over the counters of an I034/070 item
+ */
+typedef struct I034_070_Iter
+{
+    /// @brief Next counter word
+    const u8 * next;
+    /// @brief Counters left
+    u8 left;
+} I034_070_Iter;
+
+/* =============================== ACCESSORS =============================== */
+
+/// @brief Counter word at the given index (below REP)
+static inline u16 get_I034_070_WORD(const I034_070 *item, u8 index)
+{
+    const u8 *p = &item->RAW[2U * (size_t)index];
+    return (u16)(((u16)p[0U] << 8U) | p[1U]);
+}
+
+/// @brief Counter at the given index (below REP)
+static inline I034_070_COUNTER get_I034_070_COUNTER(const I034_070 *item, u8 index)
+{
+    u16 word = get_I034_070_WORD(item, index);
+    I034_070_COUNTER counter;
+
+    counter.TYP = I034_070_WORD_TYP(word);
+    counter.COUNTER = I034_070_WORD_COUNTER(word);
+    return counter;
+}
+
+/// @brief Write the counter at the given index of a counter buffer to encode (2 octets per counter)
+static inline void set_I034_070_COUNTER(u8 *raw, u8 index, eI034_070_TYP typ, u16 counter)
+{
+    u16 word = I034_070_WORD(typ, counter);
+
+    raw[2U * (size_t)index] = (u8)(word >> 8U);
+    raw[(2U * (size_t)index) + 1U] = (u8)word;
+}
+
+/// @brief Start iterating over the counters of the item
+static inline void iter_init_I034_070(I034_070_Iter *iter, const I034_070 *item)
+{
+    iter->next = item->RAW;
+    iter->left = item->REP;
+}
+
+/// @brief Unpack the next counter; eBoolean_FALSE once all have been visited
+static inline eBoolean iter_next_I034_070(I034_070_Iter *iter, I034_070_COUNTER *counter)
+{
+    u16 word = 0U;
+
+    if (iter->left == 0U)
+        return eBoolean_FALSE;
+
+    word = (u16)(((u16)iter->next[0U] << 8U) | iter->next[1U]);
+    counter->TYP = I034_070_WORD_TYP(word);
+    counter->COUNTER = I034_070_WORD_COUNTER(word);
+    iter->next += 2U;
+    iter->left--;
+    return eBoolean_TRUE;
+}
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode item I034/070 (Message Count Values) into a raw ASTERIX message.
@@ -89,12 +176,48 @@ typedef struct I034_070
 ASTERIX_LIB void encode_I034_070(BitStream *bs, const I034_070 *item);
 
 /** @brief Decode item I034/070 (Message Count Values) from a raw ASTERIX message.
+ * 
+ * Only REP is read: RAW is set to the counters, in place or in the arena of
+ * the BitStream (eAsterixStatus_ERR_ARENA if they do not fit).
  * 
  * @param[in/out] bs Pointer to the BitStream (must not be NULL)
  * @param[in/out] item Pointer to the I034_060 structure (must not be NULL)
  */
 ASTERIX_LIB void decode_I034_070(BitStream *bs, I034_070 *item);
 
+/** @brief Length in octets of the data item I034/070 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item, read from its first octet, or 0 if the item
+ * is not within the data (see bs_status())
+ */
+ASTERIX_LIB size_t length_I034_070(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/070 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_070 structure (must not be NULL)
+ * @return Length of the item (REP octet and REP counters)
+ */
+ASTERIX_LIB size_t encoded_size_I034_070(const I034_070 *item);
+
+/** @brief Move the BitStream past the data item I034/070 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_070(BitStream *bs);
+
+/** @brief Unpack all the counter words of the item at once (vectorised).
+ *
+ * @param[in] item Pointer to the I034_070 structure (must not be NULL)
+ * @param[out] words REP counter words (see I034_070_WORD_TYP/COUNTER)
+ */
+ASTERIX_LIB void unpack_I034_070(const I034_070 *item, u16 *words);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/070 (Message Count Values), see field.h */
+ASTERIX_LIB extern const FieldItem I034_070_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /** @brief Print the contents of the given I034/070 data item.
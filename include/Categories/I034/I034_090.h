@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 
 #ifdef __cplusplus
@@ -23,12 +24,21 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_090_LEN            2U
+
 /// @brief Range Error LSB = 1/128 NM
 #define I034_090_LSB_RANGEERR (0.0078125F)
 
 /// @brief Azimiuth Error LSB = 360/2^14 degrees
 #define I034_090_LSB_AZERR (0.02197265625F)
 
+/// @brief Range Error raw LSB counts per NM (1/LSB)
+#define I034_090_SCALE_RANGEERR (128.0)
+
+/// @brief Azimuth Error raw LSB counts per degree (1/LSB)
+#define I034_090_SCALE_AZERR (16384.0 / 360.0)
+
 /* ================================= ENUMS ================================= */
 
 /* ================================= STRUCTS ================================= */
@@ -51,15 +61,22 @@ typedef struct I034_090
      * 
      * LSB = 1/2^7 NM
      */
-    float RANGEERR;
+    ASTERIX_SCALED(s8) RANGEERR;
     /**
      * @brief Azimuth Error
      * 
      * LSB = 360/2^14 degrees
      */
-    float AZERR;
+    ASTERIX_SCALED(s8) AZERR;
 } I034_090;
 
+/* =============================== ACCESSORS =============================== */
+
+/// @brief get/set the range error (NM, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_090, RANGEERR, s8, I034_090_LSB_RANGEERR, I034_090_SCALE_RANGEERR)
+/// @brief get/set the azimuth error (degrees, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_090, AZERR, s8, I034_090_LSB_AZERR, I034_090_SCALE_AZERR)
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode item I034/090 (Collimation Error) into a raw ASTERIX message.
@@ -76,6 +93,38 @@ ASTERIX_LIB void encode_I034_090(BitStream *bs, const I034_090 *item);
  */
 ASTERIX_LIB void decode_I034_090(BitStream *bs, I034_090 *item);
 
+/** @brief Decode item I034/090 (Collimation Error) from its raw octets.
+ *
+ * @param[in] raw The I034_090_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_090 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_090(const u8 *raw, I034_090 *item);
+
+/** @brief Length in octets of the data item I034/090 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_090_LEN)
+ */
+ASTERIX_LIB size_t length_I034_090(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/090 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_090 structure (must not be NULL)
+ * @return Length of the item (I034_090_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_090(const I034_090 *item);
+
+/** @brief Move the BitStream past the data item I034/090 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_090(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/090 (Collimation Error), see field.h */
+ASTERIX_LIB extern const FieldItem I034_090_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /**
@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 
 #ifdef __cplusplus
@@ -23,6 +24,9 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_100_LEN            8U
+
 /**
  * @brief Rho Start/End LDB = 1/256 NM
  */
@@ -31,6 +35,10 @@ extern "C"
  * @brief Theta Start/End LSB = 360/2^16 degrees
  */
 #define I034_100_LSB_THETA  (0.0054931640625F)
+/// @brief Rho Start/End raw LSB counts per NM (1/LSB)
+#define I034_100_SCALE_RHO      (256.0)
+/// @brief Theta Start/End raw LSB counts per degree (1/LSB)
+#define I034_100_SCALE_THETA    (65536.0 / 360.0)
 
 /* ================================= ENUMS ================================= */
 
@@ -51,7 +59,7 @@ typedef struct I034_100
      * 
      * LSB = 1/256 NM
      */
-    float RHO_START;
+    ASTERIX_SCALED(u16) RHO_START;
     /**
      * @brief Rho End in Nautical Miles
      * 
@@ -59,7 +67,7 @@ typedef struct I034_100
      * 
      * LSB = 1/256 NM
      */
-    float RHO_END;
+    ASTERIX_SCALED(u16) RHO_END;
     /**
      * @brief Theta Start in degrees
      * 
@@ -67,7 +75,7 @@ typedef struct I034_100
      * 
      * LSB = 360/2^16 degrees
      */
-    float THETA_START;
+    ASTERIX_SCALED(u16) THETA_START;
     /**
      * @brief Theta End in degrees
      * 
@@ -75,9 +83,18 @@ typedef struct I034_100
      * 
      * LSB = 360/2^16 degrees
      */
-    float THETA_END;
+    ASTERIX_SCALED(u16) THETA_END;
 } I034_100;
 
+/* =============================== ACCESSORS =============================== */
+
+/// @brief get/set the window ranges (NM, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_100, RHO_START, u16, I034_100_LSB_RHO, I034_100_SCALE_RHO)
+ASTERIX_SCALED_ACCESSORS(I034_100, RHO_END, u16, I034_100_LSB_RHO, I034_100_SCALE_RHO)
+/// @brief get/set the window azimuths (degrees, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_100, THETA_START, u16, I034_100_LSB_THETA, I034_100_SCALE_THETA)
+ASTERIX_SCALED_ACCESSORS(I034_100, THETA_END, u16, I034_100_LSB_THETA, I034_100_SCALE_THETA)
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode item I034/100 (Generic Polar Window) into a raw ASTERIX message.
@@ -94,6 +111,38 @@ ASTERIX_LIB void encode_I034_100(BitStream *bs, const I034_100 *item);
  */
 ASTERIX_LIB void decode_I034_100(BitStream *bs, I034_100 *item);
 
+/** @brief Decode item I034/100 (Generic Polar Window) from its raw octets.
+ *
+ * @param[in] raw The I034_100_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_100 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_100(const u8 *raw, I034_100 *item);
+
+/** @brief Length in octets of the data item I034/100 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_100_LEN)
+ */
+ASTERIX_LIB size_t length_I034_100(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/100 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_100 structure (must not be NULL)
+ * @return Length of the item (I034_100_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_100(const I034_100 *item);
+
+/** @brief Move the BitStream past the data item I034/100 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_100(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/100 (Generic Polar Window), see field.h */
+ASTERIX_LIB extern const FieldItem I034_100_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /**
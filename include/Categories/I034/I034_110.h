@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 
 #ifdef __cplusplus
@@ -23,6 +24,9 @@ extern "C"
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_110_LEN            1U
+
 /* ================================= ENUMS ================================= */
 
 typedef enum eI034_110_TYP_T
@@ -68,6 +72,38 @@ ASTERIX_LIB void encode_I034_110(BitStream *bs, const I034_110 *item);
  */
 ASTERIX_LIB void decode_I034_110(BitStream *bs, I034_110 *item);
 
+/** @brief Decode item I034/110 (Data Filter) from its raw octets.
+ *
+ * @param[in] raw The I034_110_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_110 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_110(const u8 *raw, I034_110 *item);
+
+/** @brief Length in octets of the data item I034/110 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_110_LEN)
+ */
+ASTERIX_LIB size_t length_I034_110(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/110 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_110 structure (must not be NULL)
+ * @return Length of the item (I034_110_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_110(const I034_110 *item);
+
+/** @brief Move the BitStream past the data item I034/110 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_110(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/110 (Data Filter), see field.h */
+ASTERIX_LIB extern const FieldItem I034_110_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /**
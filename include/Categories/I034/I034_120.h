@@ -14,6 +14,7 @@
 
 /* Project libraries */
 #include <Infra/infra.h>
+#include <Infra/field.h>
 #include <Common/visibility.h>
 
 #ifdef __cplusplus
@@ -22,11 +23,17 @@ extern "C" {
 
 /* ================================= MACROS ================================= */
 
+/// @brief Length of the data item in octets
+#define I034_120_LEN            8U
+
 /// @brief Latitude in WGS84 LSB = 180/2^23 degrees
-#define I034_120_LSB_LATWGS84   (0.1200042915344238F)
+#define I034_120_LSB_LATWGS84   (0.000021457672119140625F)
 
 /// @brief Longitude in WGS84 LSB = 180/2^23 degrees
-#define I034_120_LSB_LONWGS84   (0.1200042915344238F)
+#define I034_120_LSB_LONWGS84   (0.000021457672119140625F)
+
+/// @brief Latitude/Longitude raw LSB counts per degree (1/LSB)
+#define I034_120_SCALE_WGS84    (8388608.0 / 180.0)
 
 /* ================================= ENUMS ================================= */
 
@@ -38,10 +45,10 @@ extern "C" {
  *
  * 3D-Position of Data Source in WGS 84 Co-ordinates.
  */
-typedef struct
+typedef struct I034_120
 {
-    /// @brief Height of the Data Source (meters above WGS 84 reference ellipsoid)
-    u16 HEIGHT;
+    /// @brief Height of the Data Source (meters above WGS 84 reference ellipsoid, two's complement)
+    s16 HEIGHT;
     /**
      * @brief Latitude in WGS 84
      * 
@@ -49,7 +56,7 @@ typedef struct
      * 
      * LSB = 180/2^23 degrees
      */
-    float LATWGS84;
+    ASTERIX_SCALED(s32) LATWGS84;
     /**
      * @brief Longitude in WGS 84
      * 
@@ -57,9 +64,16 @@ typedef struct
      * 
      * LSB = 180/2^23 degrees
      */
-    float LONWGS84;
+    ASTERIX_SCALED(s32) LONWGS84;
 } I034_120;
 
+/* =============================== ACCESSORS =============================== */
+
+/// @brief get/set the latitude (degrees, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_120, LATWGS84, s32, I034_120_LSB_LATWGS84, I034_120_SCALE_WGS84)
+/// @brief get/set the longitude (degrees, or raw LSB count with the _raw variants)
+ASTERIX_SCALED_ACCESSORS(I034_120, LONWGS84, s32, I034_120_LSB_LONWGS84, I034_120_SCALE_WGS84)
+
 /* =============================== DE/ENCODE =============================== */
 
 /** @brief Encode item I034/120 (3D-Position Of Data Source) into a raw ASTERIX message.
@@ -76,6 +90,38 @@ ASTERIX_LIB void encode_I034_120(BitStream *bs, const I034_120 *item);
  */
 ASTERIX_LIB void decode_I034_120(BitStream *bs, I034_120 *item);
 
+/** @brief Decode item I034/120 (3D-Position Of Data Source) from its raw octets.
+ *
+ * @param[in] raw The I034_120_LEN octets of the item (must not be NULL)
+ * @param[out] item Pointer to the I034_120 structure (must not be NULL)
+ */
+ASTERIX_LIB void read_I034_120(const u8 *raw, I034_120 *item);
+
+/** @brief Length in octets of the data item I034/120 at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item (I034_120_LEN)
+ */
+ASTERIX_LIB size_t length_I034_120(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/120 once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_120 structure (must not be NULL)
+ * @return Length of the item (I034_120_LEN)
+ */
+ASTERIX_LIB size_t encoded_size_I034_120(const I034_120 *item);
+
+/** @brief Move the BitStream past the data item I034/120 without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_120(BitStream *bs);
+
+/* ================================ METADATA =============================== */
+
+/** @brief Field metadata of data item I034/120 (3D-Position of Data Source), see field.h */
+ASTERIX_LIB extern const FieldItem I034_120_FIELDS;
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /** @brief Print the contents of the given I034/120 data item.
@@ -0,0 +1,109 @@
+/**
+ * @file I034_Builder.h
+ * @brief Category 034 records written item by item, without an I034 structure
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * A record is started with begin_I034(), each item is encoded straight into
+ * the buffer by its put_I034_xxx() in UAP order, and end_I034() writes the
+ * FSPEC of the items put and the header of the data block:
+ *
+ *     I034_Builder builder;
+ *
+ *     begin_I034(&builder, &bs);
+ *     put_I034_010(&builder, &sensor);
+ *     put_I034_000(&builder, &msg_type);
+ *     put_I034_030(&builder, &tod);
+ *     status = end_I034(&builder);
+ *
+ * The bytes are the same as those of encode_I034() for the same items.
+ */
+#ifndef I034_BUILDER_H
+#define I034_BUILDER_H
+
+/* Project libraries */
+#include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Common/visibility.h>
+#include <Categories/I034/I034.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= STRUCTS ================================= */
+
+/// @brief Category 034 record being written (see UapBuilder)
+typedef UapBuilder I034_Builder;
+
+/* =============================== DE/ENCODE =============================== */
+
+/** @brief Start a Category 034 record at the current position of the BitStream.
+ *
+ * Records of a data block are built one after the other on the same BitStream.
+ *
+ * @param[out] builder Builder of the record (must not be NULL)
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus begin_I034(I034_Builder * builder, BitStream * bs);
+
+/** @brief Encode one item of the record straight into the buffer.
+ *
+ * There is one put_I034_xxx() per item of the UAP, taking the item structure
+ * used by encode_I034_xxx(). Items must be put in UAP order, each at most once;
+ * compiled-out items (see I034_config.h) have no put_I034_xxx(). They are
+ * inline: the FRN and the length of a fixed-length item are constants, checked
+ * by uap_builder_next() without looking up the UAP.
+ *
+ * @param[in/out] builder Builder of the record (must not be NULL)
+ * @param[in] item Pointer to the item structure (must not be NULL)
+ * @return eAsterixStatus_OK, eAsterixStatus_ERR_ORDER if the item does not
+ * follow the last one put, or the first error found (see bs_status())
+ */
+#define I034_BUILDER_PUT(ID, LEN)   I034_IF(ID, I034_BUILDER_PUT_(ID, LEN))
+#define I034_BUILDER_PUT_(ID, LEN)                                                      \
+    static inline eAsterixStatus put_I034_##ID(I034_Builder * builder,                 \
+                                               const I034_##ID * item)                 \
+    {                                                                                   \
+        if (uap_builder_next(builder, (u8)eI034_FRN_I034_##ID, (LEN)))                  \
+            encode_I034_##ID(builder->bs, item);                                        \
+        return bs_status(builder->bs);                                                  \
+    }
+
+/* LEN: length of a fixed-length item, 0 for the others (see uap_builder_next()) */
+I034_BUILDER_PUT(010, I034_010_LEN)
+I034_BUILDER_PUT(000, I034_000_LEN)
+I034_BUILDER_PUT(030, I034_030_LEN)
+I034_BUILDER_PUT(020, I034_020_LEN)
+I034_BUILDER_PUT(041, I034_041_LEN)
+I034_BUILDER_PUT(050, 0U)
+I034_BUILDER_PUT(060, 0U)
+I034_BUILDER_PUT(070, 0U)
+I034_BUILDER_PUT(100, I034_100_LEN)
+I034_BUILDER_PUT(110, I034_110_LEN)
+I034_BUILDER_PUT(120, I034_120_LEN)
+I034_BUILDER_PUT(090, I034_090_LEN)
+I034_BUILDER_PUT(RE,  0U)
+I034_BUILDER_PUT(SP,  0U)
+
+#undef I034_BUILDER_PUT
+#undef I034_BUILDER_PUT_
+
+/** @brief Write the FSPEC of the items put and the header (CAT and LEN).
+ *
+ * The FSPEC has the octets needed by the items put only. Nothing is written
+ * if an error was found while building the record.
+ *
+ * @param[in/out] builder Builder of the record (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus end_I034(I034_Builder * builder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I034_BUILDER_H */
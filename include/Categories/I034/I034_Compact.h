@@ -0,0 +1,208 @@
+/**
+ * @file I034_Compact.h
+ * @brief Compact in-memory layout of decoded Category 034 messages
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef I034_COMPACT_H
+#define I034_COMPACT_H
+
+/* Project libraries */
+#include <Infra/infra.h>
+#include <Common/visibility.h>
+#include <Categories/I034/I034.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Max. size of I034_Compact (one cache line)
+#define I034_COMPACT_MAX_SIZE           64U
+
+/* ================================= STRUCTS ================================= */
+
+/**
+ * @brief I034/050 with one octet per flag (subfields as in I034_050)
+ */
+typedef struct I034_050_Compact
+{
+    ASTERIX_ENUM8(ePresenceFlag) COM;
+    ASTERIX_ENUM8(ePresenceFlag) PSR;
+    ASTERIX_ENUM8(ePresenceFlag) SSR;
+    ASTERIX_ENUM8(ePresenceFlag) MDS;
+    struct
+    {
+        ASTERIX_ENUM8(eI034_050_EXT1_NOGO)     NOGO;
+        ASTERIX_ENUM8(eI034_050_EXT1_RDPC)     RDPC;
+        ASTERIX_ENUM8(eI034_050_EXT1_RDPR)     RDPR;
+        ASTERIX_ENUM8(eI034_050_EXT1_OVLRDP)   OVLRDP;
+        ASTERIX_ENUM8(eI034_050_EXT1_OVLXMT)   OVLXMT;
+        ASTERIX_ENUM8(eI034_050_EXT1_MSC)      MSC;
+        ASTERIX_ENUM8(eI034_050_EXT1_TSV)      TSV;
+    } ext1;
+    struct
+    {
+        ASTERIX_ENUM8(eI034_050_EXT45_ANT)     ANT;
+        ASTERIX_ENUM8(eI034_050_EXT45_CHAB)    CHAB;
+        ASTERIX_ENUM8(eI034_050_EXT45_OVL)     OVL;
+        ASTERIX_ENUM8(eI034_050_EXT45_MSC)     MSC;
+    } ext4, ext5;
+    struct
+    {
+        ASTERIX_ENUM8(eI034_050_EXT6_ANT)      ANT;
+        ASTERIX_ENUM8(eI034_050_EXT6_CHAB)     CHAB;
+        ASTERIX_ENUM8(eI034_050_EXT6_OVLSUR)   OVLSUR;
+        ASTERIX_ENUM8(eI034_050_EXT6_MSC)      MSC;
+        ASTERIX_ENUM8(eI034_050_EXT6_SCF)      SCF;
+        ASTERIX_ENUM8(eI034_050_EXT6_DLF)      DLF;
+        ASTERIX_ENUM8(eI034_050_EXT6_OVLSCF)   OVLSCF;
+        ASTERIX_ENUM8(eI034_050_EXT6_OVLDLF)   OVLDLF;
+    } ext6;
+} I034_050_Compact;
+
+/**
+ * @brief I034/060 with one octet per field (subfields as in I034_060)
+ */
+typedef struct I034_060_Compact
+{
+    ASTERIX_ENUM8(ePresenceFlag) COM;
+    ASTERIX_ENUM8(ePresenceFlag) PSR;
+    ASTERIX_ENUM8(ePresenceFlag) SSR;
+    ASTERIX_ENUM8(ePresenceFlag) MDS;
+    struct
+    {
+        u8 REDRDP;
+        u8 REDXMT;
+    } ext1;
+    struct
+    {
+        ASTERIX_ENUM8(eI034_060_EXT4_POL) POL;
+        u8 REDRAD;
+        ASTERIX_ENUM8(eI034_060_EXT4_STC) STC;
+    } ext4;
+    struct
+    {
+        u8 REDRAD;
+    } ext5;
+    struct
+    {
+        u8 REDRAD;
+        ASTERIX_ENUM8(eI034_060_EXT6_CLU) CLU;
+    } ext6;
+} I034_060_Compact;
+
+/**
+ * @typedef I034_CompactCold
+ * @brief Rarely used items of a compact Category 034 message
+ *
+ * Scaled fields hold raw LSB counts (see the I034_xxx_LSB_* macros). The
+ * counters of I034/070 are not copied: RAW points to them as I034_070::RAW
+ * does, in the decoded buffer or in the arena of the BitStream.
+ */
+typedef struct I034_CompactCold
+{
+    /// @brief I034/050 - System Configuration and Status
+    I034_050_Compact I034_050;
+    /// @brief I034/060 - System Processing Mode
+    I034_060_Compact I034_060;
+    /// @brief I034/100 - Generic Polar Window (RHO_START, RHO_END, THETA_START, THETA_END)
+    u16 RHO_START;
+    u16 RHO_END;
+    u16 THETA_START;
+    u16 THETA_END;
+    /// @brief I034/120 - 3D-Position of Data Source
+    s32 LATWGS84;
+    s32 LONWGS84;
+    s16 HEIGHT;
+    /// @brief I034/090 - Collimation Error
+    s8 RANGEERR;
+    s8 AZERR;
+    /// @brief I034/110 - Data Filter
+    ASTERIX_ENUM8(eI034_110_TYP) TYP;
+    /// @brief I034/070 - Message Count Values (REP counter words, see I034_070)
+    u8 REP;
+    const u8 * RAW;
+} I034_CompactCold;
+
+/**
+ * @typedef I034_Compact
+ * @brief Compact Category 034 message: hot fields in one cache line
+ *
+ * Holds the items read on every message (I034/010, 000, 030, 020 and 041)
+ * as raw values in a few octets, and points to the rest, which only some
+ * messages carry. Per-sensor history rings can keep I034_Compact entries
+ * and a separate, smaller ring of I034_CompactCold.
+ *
+ * Presence of the items follows the FSPEC (bit FRN - 1 of present). Scaled
+ * fields hold raw LSB counts (see the I034_xxx_LSB_* macros).
+ */
+typedef struct I034_Compact
+{
+    /// @brief Rarely used items (NULL if not kept)
+    I034_CompactCold * cold;
+    /// @brief I034/030 - Time of Day (LSB = 1/128 s)
+    u32 TOD;
+    /// @brief Presence of the items (bit FRN - 1, see eI034_FRN)
+    u16 present;
+    /// @brief Length of the data block (HEADER.LEN)
+    u16 LEN;
+    /// @brief I034/041 - Antenna Rotation Speed (LSB = 1/128 s)
+    u16 ANTROTSPD;
+    /// @brief I034/010 - Data Source Identifier
+    u8 SAC;
+    u8 SIC;
+    /// @brief I034/000 - Message Type
+    ASTERIX_ENUM8(eI034_000_MSG_TYPE) MSGTYPE;
+    /// @brief I034/020 - Sector Number (LSB = 360/2^8 degrees)
+    u8 SECTAZ;
+} I034_Compact;
+
+/* =============================== DE/ENCODE =============================== */
+
+/** @brief Decode a Category 034 message straight into the compact layout.
+ *
+ * The leading fixed-length items are read straight from the wire at their
+ * offsets in the decode plan (see uap_plan()), after a single length check,
+ * and the variable-length ones decoded as they come. The rarely used items
+ * are only kept if cold is not NULL; otherwise they are skipped and left
+ * absent in present, as are RE and SP. The I034/070 counters are not copied
+ * (see I034_CompactCold::RAW).
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[out] item Pointer to the I034_Compact structure (must not be NULL)
+ * @param[out] cold Storage for the rarely used items, or NULL to skip them
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus decode_I034_compact(BitStream * bs, I034_Compact * item, I034_CompactCold * cold);
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/** @brief Convert a decoded Category 034 message to the compact layout.
+ *
+ * @param[in] rec Pointer to the I034 structure (must not be NULL)
+ * @param[out] item Pointer to the I034_Compact structure (must not be NULL)
+ * @param[out] cold Storage for the rarely used items, or NULL to drop them
+ */
+ASTERIX_LIB void compact_I034(const I034 * rec, I034_Compact * item, I034_CompactCold * cold);
+
+/** @brief Convert a compact Category 034 message back to the I034 structure.
+ *
+ * HEADER.LEN is restored as decoded. Items stored in the cold part are only
+ * restored if item->cold is set; otherwise they are marked absent in the
+ * FSPEC, as are RE and SP. The I034/070 counters are not copied: rec refers
+ * to them as the cold part does.
+ *
+ * @param[in] item Pointer to the I034_Compact structure (must not be NULL)
+ * @param[out] rec Pointer to the I034 structure (must not be NULL)
+ */
+ASTERIX_LIB void expand_I034_compact(const I034_Compact * item, I034 * rec);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I034_COMPACT_H */
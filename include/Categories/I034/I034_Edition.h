@@ -0,0 +1,124 @@
+/**
+ * @file I034_Edition.h
+ * @brief Editions of Category 034 and their selection per data source
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+#ifndef I034_EDITION_H
+#define I034_EDITION_H
+
+/* Project libraries */
+#include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Common/visibility.h>
+#include <Common/versions.h>
+#include <Categories/I034/I034.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Max. number of data sources registered with an edition (power of 2)
+#ifndef I034_MAX_SOURCES
+    #define I034_MAX_SOURCES    64U
+#endif
+
+/// @brief Edition used for the sources not registered (see versions.h)
+#if ((EDITION_NUMBER_I034 > 1) || (VERSION_NUMBER_I034 >= 29))
+    #define I034_EDITION_DEFAULT    eI034_Edition_1_29
+#elif (VERSION_NUMBER_I034 >= 28)
+    #define I034_EDITION_DEFAULT    eI034_Edition_1_28
+#else
+    #define I034_EDITION_DEFAULT    eI034_Edition_1_27
+#endif
+
+/* ================================= ENUMS ================================= */
+
+typedef enum eI034_Edition
+{
+    eI034_Edition_1_27 = 0,     /* Edition 1.27 */
+    eI034_Edition_1_28,         /* Edition 1.28: solar storm messages, per-sector counters */
+    eI034_Edition_1_29,         /* Edition 1.29: SSR and Mode S jamming strobes */
+    eI034_Edition_COUNT,
+} eI034_Edition;
+
+/* ================================= STRUCTS ================================= */
+
+/**
+ * @typedef I034_Edition
+ * @brief Tables of one edition of Category 034
+ *
+ * The editions share the layout of the records and differ in the code
+ * points a source may send, kept here as one bit per value so that checking
+ * a value costs a shift and a mask.
+ */
+typedef struct I034_Edition
+{
+    /// @brief Edition number (e.g. 1 for 1.29)
+    u8 edition;
+    /// @brief Version number (e.g. 29 for 1.29)
+    u8 version;
+    /// @brief UAP of the edition
+    const Uap * uap;
+    /// @brief Values of I034/000 MSGTYPE defined by the edition (bit per value)
+    u32 msgtype_valid;
+    /// @brief Values of I034/070 TYP defined by the edition (bit per value)
+    u32 typ_valid;
+} I034_Edition;
+
+/**
+ * @brief Tables of every supported edition, indexed by eI034_Edition
+ */
+ASTERIX_LIB extern const I034_Edition I034_EDITIONS[eI034_Edition_COUNT];
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/** @brief Register the edition sent by a data source, replacing any previous one.
+ *
+ * The edition is resolved here, once: the returned tables can be kept with
+ * the per-source state of the caller, so records need no further lookup.
+ * Registration is not thread-safe.
+ *
+ * @param[in] sac System Area Code of the source
+ * @param[in] sic System Identification Code of the source
+ * @param[in] edition Edition sent by the source
+ * @return Tables of the edition, or NULL if edition is invalid or
+ * I034_MAX_SOURCES sources are already registered
+ */
+ASTERIX_LIB const I034_Edition * register_I034_source(u8 sac, u8 sic, eI034_Edition edition);
+
+/** @brief Edition of a data source.
+ *
+ * @param[in] sac System Area Code of the source (I034/010)
+ * @param[in] sic System Identification Code of the source (I034/010)
+ * @return Tables of the edition registered for the source, or of
+ * I034_EDITION_DEFAULT if it was not registered
+ */
+ASTERIX_LIB const I034_Edition * edition_I034_source(u8 sac, u8 sic);
+
+/**
+ * @brief Forget every registered data source
+ */
+ASTERIX_LIB void clear_I034_sources(void);
+
+/** @brief Check the code points of a decoded Category 034 message against an edition.
+ *
+ * Decoding accepts every value of every edition; this tells whether the
+ * message only uses the values of the edition of its source.
+ *
+ * @param[in] edition Tables of the edition (must not be NULL)
+ * @param[in] item Pointer to the decoded I034 structure (must not be NULL)
+ * @return eAsterixStatus_OK, or eAsterixStatus_ERR_VALUE if I034/000 or
+ * I034/070 holds a value the edition does not define
+ */
+ASTERIX_LIB eAsterixStatus validate_I034(const I034_Edition * edition, const I034 * item);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I034_EDITION_H */
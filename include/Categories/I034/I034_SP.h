@@ -15,6 +15,7 @@
 /* Project libraries */
 #include <Infra/infra.h>
 #include <Common/visibility.h>
+#include <Infra/explicit.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,11 +30,19 @@ extern "C" {
 /**
  * @typedef I034_SP
  * @brief Data item I034/SP - Special Purpose Field
+ *
+ * Explicit-length field whose contents are not defined by the category: the
+ * payload is kept as on the wire, referenced in place (or in the arena of the
+ * BitStream, see bs_set_arena()) and copied back unchanged on encoding.
+ * Plugins registered for it (see explicit_register()) decode it on demand,
+ * with decode_I034_SP_plugin().
  */
 typedef struct
 {
-    /* Spare bits set to 0 */
-    uint8_t spare;
+    /// @brief Length of the item in octets, length octet included
+    u8 LEN;
+    /// @brief Payload of EXPLICIT_DATA_LEN(LEN) octets (NULL if empty)
+    const u8 * DATA;
 } I034_SP;
 
 /* =============================== DE/ENCODE =============================== */
@@ -46,12 +55,35 @@ typedef struct
 ASTERIX_LIB void encode_I034_SP(BitStream *bs, const I034_SP *item);
 
 /** @brief Decode item I034/SP (Special Purpose Field) from a raw ASTERIX message.
- * 
+ *
+ * The payload is not copied: item->DATA points into the data (see I034_SP).
+ *
  * @param[in/out] bs Pointer to the BitStream (must not be NULL)
  * @param[in/out] item Pointer to the I034_SP structure (must not be NULL)
  */
 ASTERIX_LIB void decode_I034_SP(BitStream *bs, I034_SP *item);
 
+/** @brief Length in octets of the data item I034/SP at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the item, read from its first octet, or 0 if the item
+ * is not within the data (see bs_status())
+ */
+ASTERIX_LIB size_t length_I034_SP(BitStream *bs);
+
+/** @brief Length in octets of the data item I034/SP once encoded, without encoding it.
+ *
+ * @param[in] item Pointer to the I034_SP structure (must not be NULL)
+ * @return Length of the item (item->LEN, which counts the LEN octet)
+ */
+ASTERIX_LIB size_t encoded_size_I034_SP(const I034_SP *item);
+
+/** @brief Move the BitStream past the data item I034/SP without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ */
+ASTERIX_LIB void skip_I034_SP(BitStream *bs);
+
 /* ============================== EXTRA FUNCS ============================== */
 
 /** @brief Print the contents of the given I034/SP data item.
@@ -60,6 +92,15 @@ ASTERIX_LIB void decode_I034_SP(BitStream *bs, I034_SP *item);
  */
 ASTERIX_LIB void print_I034_SP(const I034_SP *item);
 
+/** @brief Decode the payload of I034/SP with the plugin registered for it.
+ *
+ * @param[in] item Pointer to the I034_SP structure (must not be NULL)
+ * @param[out] out User structure filled by the plugin
+ * @return Status of the plugin, or eAsterixStatus_ERR_PLUGIN if none is
+ * registered for Category 034
+ */
+ASTERIX_LIB eAsterixStatus decode_I034_SP_plugin(const I034_SP *item, void *out);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,106 @@
+/**
+ * @file I034_config.h
+ * @brief Build-time selection of the Category 034 data items
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every item is built by default. Defining I034_WITH_xxx to 0 (e.g.
+ * -DI034_WITH_050=0, see the DEFINES option of the Makefile) compiles the
+ * codecs of item I034/xxx out of the library, and I034_WITH_PRINT=0 does the
+ * same for the print helpers and their format strings.
+ *
+ * A compiled-out item becomes a spare FRN of I034_UAP: the record codecs
+ * neither reference nor test it, and records using it are rejected with
+ * eAsterixStatus_ERR_FSPEC. The I034 structure keeps its layout, so users of
+ * the library need not agree on these settings.
+ */
+#ifndef I034_CONFIG_H
+#define I034_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+#ifndef I034_WITH_010
+    #define I034_WITH_010   1
+#endif
+#ifndef I034_WITH_000
+    #define I034_WITH_000   1
+#endif
+#ifndef I034_WITH_030
+    #define I034_WITH_030   1
+#endif
+#ifndef I034_WITH_020
+    #define I034_WITH_020   1
+#endif
+#ifndef I034_WITH_041
+    #define I034_WITH_041   1
+#endif
+#ifndef I034_WITH_050
+    #define I034_WITH_050   1
+#endif
+#ifndef I034_WITH_060
+    #define I034_WITH_060   1
+#endif
+#ifndef I034_WITH_070
+    #define I034_WITH_070   1
+#endif
+#ifndef I034_WITH_100
+    #define I034_WITH_100   1
+#endif
+#ifndef I034_WITH_110
+    #define I034_WITH_110   1
+#endif
+#ifndef I034_WITH_120
+    #define I034_WITH_120   1
+#endif
+#ifndef I034_WITH_090
+    #define I034_WITH_090   1
+#endif
+#ifndef I034_WITH_RE
+    #define I034_WITH_RE    1
+#endif
+#ifndef I034_WITH_SP
+    #define I034_WITH_SP    1
+#endif
+#ifndef I034_WITH_PRINT
+    #define I034_WITH_PRINT 1
+#endif
+
+/*
+ * I034_SELECT(ID, YES, NO) expands to YES if item I034/ID is built, NO
+ * otherwise, and I034_IF(ID, X) to X or nothing; they let the per-item
+ * tables and macro lists of the record codecs drop the compiled-out items.
+ */
+#define I034_SELECT(ID, YES, NO)    I034_SELECT_##ID(YES, NO)
+#define I034_IF(ID, X)              I034_SELECT_##ID(X, )
+
+#define I034_SELECT_1(YES, NO)      YES
+#define I034_SELECT_0(YES, NO)      NO
+#define I034_SELECT_BOOL(FLAG, YES, NO)  I034_SELECT_BOOL_(FLAG, YES, NO)
+#define I034_SELECT_BOOL_(FLAG, YES, NO) I034_SELECT_##FLAG(YES, NO)
+
+#define I034_SELECT_010(YES, NO)    I034_SELECT_BOOL(I034_WITH_010, YES, NO)
+#define I034_SELECT_000(YES, NO)    I034_SELECT_BOOL(I034_WITH_000, YES, NO)
+#define I034_SELECT_030(YES, NO)    I034_SELECT_BOOL(I034_WITH_030, YES, NO)
+#define I034_SELECT_020(YES, NO)    I034_SELECT_BOOL(I034_WITH_020, YES, NO)
+#define I034_SELECT_041(YES, NO)    I034_SELECT_BOOL(I034_WITH_041, YES, NO)
+#define I034_SELECT_050(YES, NO)    I034_SELECT_BOOL(I034_WITH_050, YES, NO)
+#define I034_SELECT_060(YES, NO)    I034_SELECT_BOOL(I034_WITH_060, YES, NO)
+#define I034_SELECT_070(YES, NO)    I034_SELECT_BOOL(I034_WITH_070, YES, NO)
+#define I034_SELECT_100(YES, NO)    I034_SELECT_BOOL(I034_WITH_100, YES, NO)
+#define I034_SELECT_110(YES, NO)    I034_SELECT_BOOL(I034_WITH_110, YES, NO)
+#define I034_SELECT_120(YES, NO)    I034_SELECT_BOOL(I034_WITH_120, YES, NO)
+#define I034_SELECT_090(YES, NO)    I034_SELECT_BOOL(I034_WITH_090, YES, NO)
+#define I034_SELECT_RE(YES, NO)     I034_SELECT_BOOL(I034_WITH_RE, YES, NO)
+#define I034_SELECT_SP(YES, NO)     I034_SELECT_BOOL(I034_WITH_SP, YES, NO)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I034_CONFIG_H */
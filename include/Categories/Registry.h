@@ -0,0 +1,121 @@
+/**
+ * @file Registry.h
+ * @brief Registry of the category codecs, indexed by the CAT octet
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every category describes its codecs once, as an AsterixCategory, and the
+ * registry maps the CAT octet of a data block to it with a single table
+ * lookup, so that mixed-category traffic is routed without knowing the
+ * category in advance. The categories of the library are registered from
+ * the start; user-implemented categories are added at run time with
+ * asterix_register_category(), without touching the library.
+ */
+
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+/* Project libraries */
+#include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Common/visibility.h>
+#include <Common/common_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Number of entries of the registry (one per CAT value)
+#define ASTERIX_REGISTRY_SIZE   256U
+
+/* ================================ STRUCTS ================================= */
+
+/**
+ * @typedef AsterixCategory
+ * @brief Codecs of one category
+ *
+ * Records and views are handled through untyped pointers to the structures
+ * of the category (e.g. I034 and I034_View), whose sizes are given so that
+ * callers can provide storage without knowing the category. Codecs a
+ * category does not provide are NULL.
+ */
+typedef struct AsterixCategory
+{
+    /// @brief Category number (CAT octet)
+    u8 cat;
+    /// @brief Name of the category (e.g. "I034")
+    const char * name;
+    /// @brief UAP of the category (may be NULL)
+    const Uap * uap;
+    /// @brief Size of the record structure
+    size_t record_size;
+    /// @brief Size of the view structure (0 if there is no view)
+    size_t view_size;
+    /// @brief Decode up to n_records records of a data block (see decode_I034_batch())
+    size_t (*decode)(BitStream * bs, void * records, size_t n_records);
+    /// @brief Same as decode, for the items in mask only (see decode_I034_batch_masked())
+    size_t (*decode_masked)(BitStream * bs, void * records, size_t n_records, u64 mask);
+    /// @brief Append one record to a data block (see encode_I034())
+    eAsterixStatus (*encode)(BitStream * bs, const void * record);
+    /// @brief Move past one record at the current position (see skip_I034_record())
+    eAsterixStatus (*skip)(BitStream * bs);
+    /// @brief Build a read-only view of the first record of a data block (see view_I034())
+    eAsterixStatus (*view)(void * view, const u8 * data, size_t size);
+    /// @brief Print a decoded record (see print_I034())
+    void (*print)(const void * record);
+} AsterixCategory;
+
+/* =============================== DE/ENCODE =============================== */
+
+/** @brief Decode the records of a data block with the codecs registered for its CAT.
+ *
+ * The header is validated, then the block is handed to the decoder of its
+ * category in one call, which fills storage with as many records as fit
+ * (storage_size / record_size) or the block holds. As with
+ * decode_I034_batch(), calling it again with the same BitStream resumes
+ * after the last record decoded.
+ *
+ * @param[in/out] bs Pointer to the BitStream over the data block (must not be NULL)
+ * @param[out] storage Storage for the decoded records (suitably aligned for them)
+ * @param[in] storage_size Size of the storage in octets
+ * @param[out] category Codecs of the category of the block (NULL if unknown)
+ * @return Number of records decoded; on error bs_status() tells why, with
+ * eAsterixStatus_ERR_CAT if no codec is registered for the category
+ */
+ASTERIX_LIB size_t asterix_decode_block(BitStream * bs, void * storage, size_t storage_size,
+                                        const AsterixCategory ** category);
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/** @brief Register the codecs of a category, replacing those of the same CAT.
+ *
+ * The structure is referenced, not copied: it must outlive its registration.
+ * Registration is not thread-safe: categories are expected to be registered
+ * once at start-up, before decoding.
+ *
+ * @param[in] category Codecs of the category (must not be NULL)
+ */
+ASTERIX_LIB void asterix_register_category(const AsterixCategory * category);
+
+/** @brief Remove the codecs registered for a category (built-in ones included).
+ *
+ * @param[in] cat Category number
+ */
+ASTERIX_LIB void asterix_unregister_category(u8 cat);
+
+/** @brief Codecs registered for a category.
+ *
+ * @param[in] cat Category number (e.g. the CAT octet of a data block)
+ * @return The codecs, or NULL if none are registered
+ */
+ASTERIX_LIB const AsterixCategory * asterix_category(u8 cat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REGISTRY_H */
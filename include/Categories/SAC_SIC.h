@@ -56,6 +56,14 @@ void encode_SAC_SIC(BitStream *bs, const SAC_SIC *item);
  */
 void decode_SAC_SIC(BitStream *bs, SAC_SIC *item);
 
+/**
+ * @brief Decode the SAC/SIC data item of the calling category from its 2 raw octets.
+ *
+ * @param[in] raw The octets of the item (must not be NULL)
+ * @param[out] item Pointer to the SAC_SIC structure (must not be NULL)
+ */
+void read_SAC_SIC(const u8 *raw, SAC_SIC *item);
+
 #ifdef __cplusplus
 }
 #endif
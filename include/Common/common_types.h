@@ -25,4 +25,24 @@ typedef enum eBoolean
     eBoolean_TRUE  = 1,
 } eBoolean;
 
+/**
+ * @brief Result of the encoding/decoding of an ASTERIX data block or record
+ *
+ * Errors are sticky: once a BitStream reports one, it is kept until the
+ * stream is initialised again and every subsequent item is skipped.
+ */
+typedef enum eAsterixStatus
+{
+    eAsterixStatus_OK          = 0, /* No error */
+    eAsterixStatus_ERR_LEN,         /* LEN field inconsistent with the buffer */
+    eAsterixStatus_ERR_OVERRUN,     /* Record content runs past the data block */
+    eAsterixStatus_ERR_FSPEC,       /* FSPEC references items beyond the UAP */
+    eAsterixStatus_ERR_ARENA,       /* Arena too small for the variable parts of the items */
+    eAsterixStatus_ERR_PLUGIN,      /* No plugin registered for an explicit-length field */
+    eAsterixStatus_ERR_CAT,         /* No codec registered for the category of the block */
+    eAsterixStatus_ERR_VALUE,       /* Value not defined by the edition of the category */
+    eAsterixStatus_ERR_FIELD,       /* Field path naming no field of the category */
+    eAsterixStatus_ERR_ORDER,       /* Item written out of UAP (FRN) order */
+} eAsterixStatus;
+
 #endif /* COMMON_TYPES_H */
\ No newline at end of file
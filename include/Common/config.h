@@ -0,0 +1,55 @@
+/**
+ * @file config.h
+ * @brief Build-time configuration of the library
+ *
+ * - ASTERIX_RAW_FIELDS: scaled fields (times, ranges, angles...) are stored in
+ *   the item structures as the raw LSB count transmitted on the wire, and are
+ *   only converted to engineering units by the float accessors.
+ * - ASTERIX_NO_FLOAT: the library does not use floating point at all (targets
+ *   without FPU). Implies ASTERIX_RAW_FIELDS; the float accessors and the
+ *   bs_*float()/bs_*double() helpers are not available.
+ * - ASTERIX_NO_SIMD: only the scalar kernels are built (see Infra/cpu_dispatch.h).
+ *   Implied by ASTERIX_NO_FLOAT, as vector registers are off limits there too.
+ * - ASTERIX_NO_PLAN_CACHE: records are decoded without the per-thread cache
+ *   of FSPEC decode plans (see Infra/uap.h). Implied when the compiler has no
+ *   thread-local storage.
+ *
+ * They are expected on the compiler command line (see the RAW and FLOAT options
+ * of the Makefile) so that the library and its users agree on the layouts.
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(ASTERIX_NO_FLOAT) && !defined(ASTERIX_RAW_FIELDS)
+    #define ASTERIX_RAW_FIELDS
+#endif /* ASTERIX_NO_FLOAT */
+
+#if defined(ASTERIX_NO_FLOAT) && !defined(ASTERIX_NO_SIMD)
+    #define ASTERIX_NO_SIMD
+#endif /* ASTERIX_NO_FLOAT */
+
+/* Thread-local storage class of the compiler, if any */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+    #define ASTERIX_THREAD_LOCAL    _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+    #define ASTERIX_THREAD_LOCAL    __thread
+#elif defined(_MSC_VER)
+    #define ASTERIX_THREAD_LOCAL    __declspec(thread)
+#elif !defined(ASTERIX_NO_PLAN_CACHE)
+    #define ASTERIX_NO_PLAN_CACHE
+#endif
+
+/* Compile-time check (e.g. structure sizes), usable at file scope in C99 */
+#define ASTERIX_STATIC_ASSERT(COND, NAME) \
+    typedef char asterix_static_assert_##NAME[(COND) ? 1 : -1]
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_H */
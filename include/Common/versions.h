@@ -1,6 +1,10 @@
 /**
  * @file versions.h
  * @brief Configuration header to manage the target category of the library
+ *
+ * Every supported edition of a category is compiled in and selected per
+ * source at run time; these numbers only pick the edition used for sources
+ * that were not registered with one.
  */
 
 #ifndef VERSIONS_H
@@ -0,0 +1,141 @@
+/**
+ * @file block.h
+ * @brief Iteration over the data blocks of a datagram and the records of a block
+ *
+ * A datagram (e.g. one UDP payload) carries one or more data blocks back to
+ * back, each made of a CAT/LEN header and one or more records of that
+ * category. The iterators only locate blocks and records: nothing is decoded,
+ * and each record is reported as a byte range that a category codec (or a
+ * view) can then be pointed at.
+ */
+
+#ifndef BLOCK_H
+#define BLOCK_H
+
+#include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Common/common_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Length of the header (CAT and LEN) of a data block
+#define ASTERIX_BLOCK_HEADER_LEN    3U
+
+/* ================================= STRUCTS ================================= */
+
+/**
+ * @brief One data block of a datagram
+ */
+typedef struct AsterixBlock
+{
+    /// @brief First octet of the block (its CAT octet)
+    const u8 *  data;
+    /// @brief Offset of the block in the datagram
+    size_t      offset;
+    /// @brief Category of the block
+    u8          cat;
+    /// @brief Length of the block in octets, header included
+    u16         len;
+} AsterixBlock;
+
+/**
+ * @brief Cursor over the data blocks of a datagram
+ */
+typedef struct AsterixBlockIter
+{
+    const u8 *      data;
+    size_t          size;
+    /// @brief Offset of the next block
+    size_t          pos;
+    /// @brief Sticky error state (eAsterixStatus_ERR_LEN on a malformed header)
+    eAsterixStatus  status;
+} AsterixBlockIter;
+
+/**
+ * @brief One record of a data block
+ */
+typedef struct AsterixRecord
+{
+    /// @brief First octet of the record (its FSPEC)
+    const u8 *  data;
+    /// @brief Offset of the record in the data block
+    size_t      offset;
+    /// @brief Length of the record in octets
+    size_t      len;
+} AsterixRecord;
+
+/**
+ * @brief Cursor over the records of a data block
+ */
+typedef struct AsterixRecordIter
+{
+    /// @brief Stream over the data block, positioned on the next record
+    BitStream   bs;
+    /// @brief UAP of the category of the block
+    const Uap * uap;
+} AsterixRecordIter;
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/** @brief Start iterating over the data blocks of a datagram.
+ *
+ * @param[out] it Pointer to the iterator (must not be NULL)
+ * @param[in] data Datagram (must not be NULL)
+ * @param[in] size Size of the datagram in octets
+ */
+ASTERIX_LIB void block_iter_init(AsterixBlockIter *it, const u8 *data, size_t size);
+
+/** @brief Next data block of the datagram.
+ *
+ * Stops at the end of the datagram, or at the first block whose LEN is
+ * shorter than its header or runs past the datagram (see block_iter_status()).
+ *
+ * @param[in/out] it Pointer to the iterator (must not be NULL)
+ * @param[out] block Location of the block
+ * @return eBoolean_TRUE if a block was found, eBoolean_FALSE at the end or on error
+ */
+ASTERIX_LIB eBoolean block_iter_next(AsterixBlockIter *it, AsterixBlock *block);
+
+static inline eAsterixStatus block_iter_status(const AsterixBlockIter *it)
+{
+    return it->status;
+}
+
+/** @brief Start iterating over the records of a data block.
+ *
+ * The UAP is the one of the category of the block (block->cat); it is only
+ * used to measure the records.
+ *
+ * @param[out] it Pointer to the iterator (must not be NULL)
+ * @param[in] block Data block, as returned by block_iter_next() (must not be NULL)
+ * @param[in] uap UAP of the category of the block (must not be NULL)
+ * @return eAsterixStatus_OK, or eAsterixStatus_ERR_LEN if the header is invalid
+ */
+ASTERIX_LIB eAsterixStatus record_iter_init(AsterixRecordIter *it, const AsterixBlock *block, const Uap *uap);
+
+/** @brief Next record of the data block.
+ *
+ * The record is measured from its FSPEC and the lengths of its items, not
+ * decoded. Stops at the end of the block or at the first malformed record
+ * (see record_iter_status()).
+ *
+ * @param[in/out] it Pointer to the iterator (must not be NULL)
+ * @param[out] record Location of the record
+ * @return eBoolean_TRUE if a record was found, eBoolean_FALSE at the end or on error
+ */
+ASTERIX_LIB eBoolean record_iter_next(AsterixRecordIter *it, AsterixRecord *record);
+
+static inline eAsterixStatus record_iter_status(const AsterixRecordIter *it)
+{
+    return bs_status(&it->bs);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BLOCK_H */
@@ -0,0 +1,126 @@
+/**
+ * @file compound.h
+ * @brief Generic codec of compound data items
+ *
+ * A compound item is a primary subfield (FX-chained octets, one presence bit
+ * per subfield, laid out as an FSPEC) followed by the subfields present. An
+ * item describes its subfields once, as a static table of descriptors, and
+ * the engine handles the primary subfield, the length checks and the
+ * presence flags of the item structure: the item only provides the bit
+ * layout of each subfield.
+ */
+
+#ifndef COMPOUND_H
+#define COMPOUND_H
+
+#include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Common/common_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Max. number of subfields of a compound item (4 primary octets)
+#define COMPOUND_MAX_SUBFIELDS  28U
+
+/// @brief Max. length in octets of one subfield
+#define COMPOUND_MAX_SUBFIELD_LEN   32U
+
+/// @brief Offset of a field the item structure does not have
+#define COMPOUND_NO_FIELD       ((size_t)-1)
+
+/* ================================= STRUCTS ================================= */
+
+/// @brief Subfield encoder: packs the subfield structure into its len octets
+typedef void (*CompoundEncodeFn)(u8 *raw, const void *sub);
+
+/// @brief Subfield decoder: unpacks the len octets into the subfield structure
+typedef void (*CompoundDecodeFn)(const u8 *raw, void *sub);
+
+/**
+ * @brief One subfield (bit of the primary subfield) of a compound item
+ *
+ * Spare subfields have a length of 0 and NULL codecs: their presence bit is
+ * never set on encoding, and rejected on decoding as are the bits beyond the
+ * subfields described (see compound_decode()).
+ */
+typedef struct CompoundSubfield
+{
+    /// @brief Name of the subfield (e.g. "COM")
+    const char *        name;
+    /// @brief Length in octets (0 for a spare subfield)
+    size_t              len;
+    /// @brief Offset of the ePresenceFlag of the subfield in the item structure
+    size_t              flag_offset;
+    /// @brief Offset of the subfield structure in the item structure
+    size_t              offset;
+    CompoundEncodeFn    encode;
+    CompoundDecodeFn    decode;
+} CompoundSubfield;
+
+/**
+ * @brief Description of a compound item
+ */
+typedef struct Compound
+{
+    /// @brief Name of the data item (e.g. "I034/050")
+    const char *                name;
+    /// @brief Number of subfields described (at most COMPOUND_MAX_SUBFIELDS)
+    size_t                      n_subfields;
+    /// @brief Subfields indexed by their bit in the primary subfield (0 = bit 8 of octet 1)
+    const CompoundSubfield *    subfields;
+    /// @brief Offset of the ePresenceFlag FX of the first primary octet (or COMPOUND_NO_FIELD)
+    size_t                      fx_offset;
+} Compound;
+
+/* =============================== DE/ENCODE =============================== */
+
+/** @brief Encode a compound item: shortest primary subfield, then the present subfields.
+ *
+ * The whole item is checked once against the buffer before being written.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] compound Description of the item (must not be NULL)
+ * @param[in] item Item structure (must not be NULL)
+ */
+ASTERIX_LIB void compound_encode(BitStream *bs, const Compound *compound, const void *item);
+
+/** @brief Decode a compound item into its structure.
+ *
+ * The primary subfield is read in one pass and the present subfields are
+ * checked at once, then unpacked; the flags of absent subfields are cleared.
+ * A primary subfield flagging a spare subfield, or one beyond those
+ * described (e.g. in an FX extension the item does not define), cannot be
+ * measured: eAsterixStatus_ERR_FSPEC is latched and the item is not decoded.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] compound Description of the item (must not be NULL)
+ * @param[out] item Item structure (must not be NULL)
+ */
+ASTERIX_LIB void compound_decode(BitStream *bs, const Compound *compound, void *item);
+
+/** @brief Length in octets of the compound item at the current position, without decoding it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] compound Description of the item (must not be NULL)
+ * @return Length of the item, or 0 on error, e.g. eAsterixStatus_ERR_FSPEC for
+ * a primary subfield flagging a spare or undescribed subfield (see bs_status())
+ */
+ASTERIX_LIB size_t compound_length(BitStream *bs, const Compound *compound);
+
+/** @brief Length in octets of a compound item once encoded, without encoding it.
+ *
+ * @param[in] compound Description of the item (must not be NULL)
+ * @param[in] item Item structure (must not be NULL)
+ * @return Length of the shortest primary subfield and of the present subfields
+ */
+ASTERIX_LIB size_t compound_encoded_size(const Compound *compound, const void *item);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMPOUND_H */
@@ -0,0 +1,117 @@
+/**
+ * @file cpu_dispatch.h
+ * @brief Runtime selection of the SIMD kernels used by the library
+ *
+ * The library is built for the baseline of its target architecture, and the
+ * kernels for wider instruction sets (SSE2/AVX2 on x86, NEON on AArch64) are
+ * compiled per function with target attributes. The best level supported by
+ * the host is chosen once when the library is loaded, and can be forced with
+ * asterix_cpu_set_level() or with the ASTERIX_CPU_LEVEL environment variable
+ * ("scalar", "sse2", "avx2" or "neon"), e.g. for testing and benchmarking.
+ *
+ * The scalar kernels are always available and are the reference behaviour of
+ * every other level.
+ */
+
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+#include <Infra/infra.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= ENUMS ================================= */
+
+/**
+ * @brief Instruction set level of the kernels in use
+ */
+typedef enum eAsterixCpuLevel
+{
+    eAsterixCpuLevel_SCALAR = 0,    /* Portable C, always available */
+    eAsterixCpuLevel_SSE2,          /* x86 SSE2 (128 bits) */
+    eAsterixCpuLevel_AVX2,          /* x86 AVX2 (256 bits) */
+    eAsterixCpuLevel_NEON,          /* AArch64 Advanced SIMD (128 bits) */
+} eAsterixCpuLevel;
+
+/* ================================= STRUCTS ================================= */
+
+/**
+ * @brief Set of kernels of one instruction set level
+ */
+typedef struct AsterixKernels
+{
+    /// @brief Level implemented by this table
+    eAsterixCpuLevel level;
+
+    /**
+     * @brief Length of the FX-terminated chain of octets (FSPEC, extensible
+     * items) starting at src: index of the first octet with its LSB clear,
+     * plus one, or 0 if none of the n octets ends the chain.
+     */
+    size_t (*fx_scan)(const u8 *src, size_t n);
+
+    /// @brief Unpack n big-endian 16-bit words from src into dst
+    void (*be16_unpack)(u16 *dst, const u8 *src, size_t n);
+
+#ifndef ASTERIX_NO_FLOAT
+    /// @brief dst[i] = (float)(src[i] * lsb) for n raw LSB counts
+    void (*raw_to_float)(float *dst, const s32 *src, size_t n, double lsb);
+#endif /* ASTERIX_NO_FLOAT */
+} AsterixKernels;
+
+/* =============================== DISPATCH =============================== */
+
+/**
+ * @brief Kernels currently in use (never NULL)
+ */
+ASTERIX_LIB extern const AsterixKernels *asterix_kernels;
+
+/**
+ * @brief Best level supported by both the library build and the host CPU
+ */
+ASTERIX_LIB eAsterixCpuLevel asterix_cpu_detect(void);
+
+/**
+ * @brief Level of the kernels currently in use
+ */
+ASTERIX_LIB eAsterixCpuLevel asterix_cpu_level(void);
+
+/** @brief Force the kernels of the given level
+ *
+ * Not thread-safe: meant to be called before any encoding/decoding starts.
+ *
+ * @param[in] level Level to use (must be supported, see asterix_cpu_detect())
+ * @return eBoolean_TRUE if the level is now in use, eBoolean_FALSE (and no
+ * change) if the host or the build cannot run it.
+ */
+ASTERIX_LIB eBoolean asterix_cpu_set_level(eAsterixCpuLevel level);
+
+/**
+ * @brief Printable name of a level ("scalar", "sse2", "avx2" or "neon")
+ */
+ASTERIX_LIB const char *asterix_cpu_level_name(eAsterixCpuLevel level);
+
+/* ============================== EXTRA FUNCS ============================== */
+
+static inline size_t asterix_fx_scan(const u8 *src, size_t n)
+{
+    return asterix_kernels->fx_scan(src, n);
+}
+static inline void asterix_be16_unpack(u16 *dst, const u8 *src, size_t n)
+{
+    asterix_kernels->be16_unpack(dst, src, n);
+}
+#ifndef ASTERIX_NO_FLOAT
+static inline void asterix_raw_to_float(float *dst, const s32 *src, size_t n, double lsb)
+{
+    asterix_kernels->raw_to_float(dst, src, n, lsb);
+}
+#endif /* ASTERIX_NO_FLOAT */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_DISPATCH_H */
@@ -0,0 +1,126 @@
+/**
+ * @file explicit.h
+ * @brief Explicit-length data fields (Reserved Expansion and Special Purpose)
+ *
+ * An explicit-length field is a length octet, counting itself, followed by
+ * octets whose layout the category does not define. The library keeps them
+ * opaque: decoding yields a (pointer, length) span over the payload and
+ * encoding copies the payload back unchanged, so that gateways forward
+ * vendor extensions without understanding them. Users who know the layout
+ * of a field register a plugin for it, called only when asked for.
+ */
+
+#ifndef EXPLICIT_H
+#define EXPLICIT_H
+
+#include <Infra/infra.h>
+#include <Common/common_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Length of the payload of an explicit-length field from its length octet
+#define EXPLICIT_DATA_LEN(LEN)      (((LEN) != 0U) ? ((size_t)(LEN) - 1U) : 0U)
+
+/* ================================= ENUMS ================================= */
+
+/**
+ * @brief Explicit-length fields a category may carry
+ */
+typedef enum eExplicitField
+{
+    eExplicitField_RE = 0,  /* Reserved Expansion Field */
+    eExplicitField_SP,      /* Special Purpose Field */
+    eExplicitField_COUNT,
+} eExplicitField;
+
+/* ================================= STRUCTS ================================= */
+
+/**
+ * @brief Plugin decoding the payload of an explicit-length field
+ *
+ * @param[in] data Payload (length octet excluded, NULL if empty)
+ * @param[in] len Length of the payload in octets
+ * @param[out] out User structure receiving the decoded field
+ * @return eAsterixStatus_OK, or an error if the payload is not understood
+ */
+typedef eAsterixStatus (*ExplicitDecodeFn)(const u8 *data, size_t len, void *out);
+
+/* =============================== DE/ENCODE =============================== */
+
+/** @brief Encode an explicit-length field: length octet, then the payload as is.
+ *
+ * Sets eAsterixStatus_ERR_LEN if len is 0 (the length octet counts itself).
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] len Length octet of the field
+ * @param[in] data Payload of EXPLICIT_DATA_LEN(len) octets (may be NULL if empty)
+ */
+ASTERIX_LIB void explicit_encode(BitStream *bs, u8 len, const u8 *data);
+
+/** @brief Decode an explicit-length field without copying its payload.
+ *
+ * The payload is referenced in place, or copied to the arena of the
+ * BitStream if one is set (see bs_ref_ptr()).
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[out] len Length octet of the field (0 on error)
+ * @return Payload of EXPLICIT_DATA_LEN(*len) octets, or NULL if empty or on error
+ */
+ASTERIX_LIB const u8 *explicit_decode(BitStream *bs, u8 *len);
+
+/** @brief Length in octets of the explicit-length field at the current position.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @return Length of the field, or 0 on error (see bs_status())
+ */
+ASTERIX_LIB size_t explicit_length(BitStream *bs);
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/** @brief Register the plugin decoding a field of a category, replacing any previous one.
+ *
+ * Registration is not thread-safe: plugins are expected to be registered
+ * once at start-up, before decoding.
+ *
+ * @param[in] cat Category of the field
+ * @param[in] field Field of the category
+ * @param[in] decode Plugin, or NULL to unregister
+ * @return eAsterixStatus_OK, or eAsterixStatus_ERR_PLUGIN if field is invalid
+ */
+ASTERIX_LIB eAsterixStatus explicit_register(u8 cat, eExplicitField field, ExplicitDecodeFn decode);
+
+/** @brief Plugin registered for a field of a category.
+ *
+ * @param[in] cat Category of the field
+ * @param[in] field Field of the category
+ * @return The plugin, or NULL if none is registered
+ */
+ASTERIX_LIB ExplicitDecodeFn explicit_plugin(u8 cat, eExplicitField field);
+
+/** @brief Decode the payload of a field with the plugin registered for it.
+ *
+ * @param[in] cat Category of the field
+ * @param[in] field Field of the category
+ * @param[in] data Payload of the field
+ * @param[in] len Length of the payload in octets
+ * @param[out] out User structure passed to the plugin
+ * @return Status of the plugin, or eAsterixStatus_ERR_PLUGIN if none is registered
+ */
+ASTERIX_LIB eAsterixStatus explicit_decode_plugin(u8 cat, eExplicitField field, const u8 *data, size_t len, void *out);
+
+/** @brief Print the payload of an explicit-length field as hexadecimal octets.
+ *
+ * @param[in] len Length octet of the field
+ * @param[in] data Payload of the field
+ */
+ASTERIX_LIB void explicit_print(u8 len, const u8 *data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EXPLICIT_H */
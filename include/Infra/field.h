@@ -0,0 +1,265 @@
+/**
+ * @file field.h
+ * @brief Field metadata of the data items and field access by path
+ *
+ * Every item describes its fields once, as a static table giving their bit
+ * position, width, signedness, LSB and value labels, so that tools can read
+ * any field without per-item code. A field path such as
+ * "I034/050.ext1.OVLRDP" or "I034/120.LATWGS84" is compiled once into a
+ * FieldAccessor (item, position and conversion resolved); reading the field
+ * of a record is then a presence check and a shift/mask over the raw octets
+ * located by the index of the record (see uap_index_items()).
+ *
+ * Paths name the item, then the subfield of a compound item (its member in
+ * the item structure, e.g. "ext1"), then the field. Fields of a repetitive
+ * item take the repetition index after the item: "I034/070[2].COUNTER".
+ */
+
+#ifndef FIELD_H
+#define FIELD_H
+
+#include <Infra/infra.h>
+#include <Infra/uap.h>
+#include <Infra/compound.h>
+#include <Common/common_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Max. width in bits of a field
+#define FIELD_MAX_WIDTH     32U
+
+/// @brief Max. number of octets a field spans (FIELD_MAX_WIDTH bits, unaligned)
+#define FIELD_MAX_OCTETS    5U
+
+/// @brief No subfield (fields of a fixed or repetitive item)
+#define FIELD_NO_SUBFIELD   0xFFU
+
+/*
+ * Entries of the static metadata tables of the items: unsigned and signed
+ * counts of LSB = NUM / DEN (in UNIT, NULL for plain counts), and
+ * enumerated fields with their labels (array of FieldLabel)
+ */
+#define FIELD_UNSIGNED(NAME, BIT, WIDTH, NUM, DEN, UNIT) \
+    { (NAME), (BIT), (WIDTH), (u8)eFieldType_UNSIGNED, (NUM), (DEN), (UNIT), NULL, 0U }
+#define FIELD_SIGNED(NAME, BIT, WIDTH, NUM, DEN, UNIT) \
+    { (NAME), (BIT), (WIDTH), (u8)eFieldType_SIGNED, (NUM), (DEN), (UNIT), NULL, 0U }
+#define FIELD_ENUM(NAME, BIT, WIDTH, LABELS) \
+    { (NAME), (BIT), (WIDTH), (u8)eFieldType_ENUM, 1, 1U, NULL, (LABELS), FIELD_COUNT(LABELS) }
+
+/// @brief Group of the fields of an item (NAME NULL) or of one subfield
+#define FIELD_GROUP(NAME, SUBFIELD, FIELDS) \
+    { (NAME), (SUBFIELD), (FIELDS), FIELD_COUNT(FIELDS) }
+
+/// @brief Number of entries of a static table
+#define FIELD_COUNT(TABLE)  (sizeof(TABLE) / sizeof((TABLE)[0]))
+
+/* ================================= ENUMS ================================= */
+
+typedef enum eFieldType
+{
+    eFieldType_UNSIGNED = 0,    /* Unsigned count of LSB */
+    eFieldType_SIGNED,          /* Two's complement count of LSB */
+    eFieldType_ENUM,            /* Code point, see FieldMeta::labels */
+} eFieldType;
+
+/* ================================= STRUCTS ================================= */
+
+/// @brief Label of one value of an enumerated field
+typedef struct FieldLabel
+{
+    u32             value;
+    const char *    label;
+} FieldLabel;
+
+/**
+ * @brief Description of one field
+ *
+ * The position is counted in bits from the most significant bit of the
+ * first octet of the item, or of the subfield (compound items) or the
+ * repetition (repetitive items) holding the field. The LSB is kept as a
+ * ratio so that it is exact and usable without floating point.
+ */
+typedef struct FieldMeta
+{
+    /// @brief Name of the field (e.g. "OVLRDP")
+    const char *        name;
+    /// @brief Position of the first (most significant) bit
+    u16                 bit;
+    /// @brief Width in bits (1 to FIELD_MAX_WIDTH)
+    u8                  width;
+    /// @brief eFieldType of the field
+    u8                  type;
+    /// @brief LSB numerator (value = raw * lsb_num / lsb_den)
+    s32                 lsb_num;
+    /// @brief LSB denominator
+    u32                 lsb_den;
+    /// @brief Unit of the value (NULL if none)
+    const char *        unit;
+    /// @brief Labels of the values of an enumerated field (NULL if none)
+    const FieldLabel *  labels;
+    /// @brief Number of labels
+    size_t              n_labels;
+} FieldMeta;
+
+/**
+ * @brief Fields of an item, or of one subfield of a compound item
+ */
+typedef struct FieldGroup
+{
+    /// @brief Name of the subfield (e.g. "ext1"), NULL for the fields of the item itself
+    const char *        name;
+    /// @brief Bit of the subfield in the primary subfield (see Compound), or FIELD_NO_SUBFIELD
+    u8                  subfield;
+    /// @brief Fields of the group
+    const FieldMeta *   fields;
+    /// @brief Number of fields
+    size_t              n_fields;
+} FieldGroup;
+
+/**
+ * @brief Field metadata of one data item
+ */
+typedef struct FieldItem
+{
+    /// @brief Name of the data item (e.g. "I034/050")
+    const char *        name;
+    /// @brief eUapItemKind of the item (FIXED, REPETITIVE or COMPOUND)
+    u8                  kind;
+    /// @brief Octets per repetition (repetitive items)
+    u8                  rep_len;
+    /// @brief Subfields of the item (compound items, NULL otherwise)
+    const Compound *    compound;
+    /// @brief Field groups of the item
+    const FieldGroup *  groups;
+    /// @brief Number of field groups
+    size_t              n_groups;
+} FieldItem;
+
+/**
+ * @brief Field path compiled by field_compile()
+ *
+ * Everything that does not depend on the record is resolved: reading the
+ * field only locates the item and, for compound and repetitive items, the
+ * subfield or repetition.
+ */
+typedef struct FieldAccessor
+{
+    /// @brief Item holding the field
+    const FieldItem *   item;
+    /// @brief Description of the field
+    const FieldMeta *   field;
+    /// @brief FRN of the item
+    u8                  frn;
+    /// @brief eUapItemKind of the item
+    u8                  kind;
+    /// @brief Bit of the subfield (compound items), or FIELD_NO_SUBFIELD
+    u8                  subfield;
+    /// @brief Number of octets loaded (1 to FIELD_MAX_OCTETS)
+    u8                  n_octets;
+    /// @brief Right shift of the loaded octets
+    u8                  shift;
+    /// @brief Sign bit of the field (0 if unsigned)
+    u8                  sign;
+    /// @brief Repetition index (repetitive items)
+    u16                 index;
+    /// @brief Octet of the field in its item, subfield or repetition
+    u16                 offset;
+    /// @brief Mask of the field once shifted
+    u32                 mask;
+} FieldAccessor;
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/** @brief Compile a field path into an accessor.
+ *
+ * @param[out] acc Accessor (must not be NULL)
+ * @param[in] items Field metadata of the items of a category, indexed by
+ * FRN - 1 (NULL entries for items without fields)
+ * @param[in] n_items Number of entries of items
+ * @param[in] path Field path (e.g. "I034/120.LATWGS84", must not be NULL)
+ * @return eAsterixStatus_OK, or eAsterixStatus_ERR_FIELD if the path names
+ * no field of the items
+ */
+ASTERIX_LIB eAsterixStatus field_compile(FieldAccessor *acc, const FieldItem *const *items,
+                                         size_t n_items, const char *path);
+
+/** @brief First octet of the subfield or repetition of a compound or repetitive item.
+ *
+ * @param[in] acc Compiled accessor (must not be NULL)
+ * @param[in] item First octet of the item
+ * @param[in] length Length of the item in octets
+ * @return First octet of the subfield or repetition, or NULL if the record
+ * does not hold it
+ */
+ASTERIX_LIB const u8 *field_locate(const FieldAccessor *acc, const u8 *item, size_t length);
+
+/** @brief Read the raw value of a field from the octets of an indexed record.
+ *
+ * @param[in] acc Compiled accessor (must not be NULL)
+ * @param[in] data Octets the record was indexed from (see UapItemRef::offset)
+ * @param[in] refs Location of the items of the record, indexed by FRN - 1
+ * @param[out] raw Raw value of the field, sign-extended (count of LSB or code point)
+ * @return eBoolean_TRUE, or eBoolean_FALSE leaving raw untouched if the
+ * record does not hold the field
+ */
+static inline eBoolean field_read(const FieldAccessor *acc, const u8 *data,
+                                  const UapItemRef *refs, s64 *raw)
+{
+    const UapItemRef *ref = &refs[acc->frn - 1U];
+    const u8 *p = NULL;
+    u64 word = 0U;
+    u32 value = 0U;
+    size_t i = 0U;
+
+    if (ref->frn == 0U)
+        return eBoolean_FALSE;
+    p = data + ref->offset;
+    if (acc->kind != (u8)eUapItemKind_FIXED)
+    {
+        p = field_locate(acc, p, ref->length);
+        if (p == NULL)
+            return eBoolean_FALSE;
+    }
+
+    p += acc->offset;
+    for (i = 0U; i < acc->n_octets; i++)
+        word = (word << 8U) | p[i];
+    value = (u32)(word >> acc->shift) & acc->mask;
+
+    /* Sign-extend two's complement fields */
+    if ((acc->sign != 0U) && ((value >> (acc->sign - 1U)) & 1U))
+        *raw = (s64)value - ((s64)1 << acc->sign);
+    else
+        *raw = (s64)value;
+    return eBoolean_TRUE;
+}
+
+#ifndef ASTERIX_NO_FLOAT
+/** @brief Value of a field in engineering units (raw * LSB).
+ *
+ * @param[in] field Description of the field (must not be NULL)
+ * @param[in] raw Raw value, as read by field_read()
+ */
+static inline double field_value(const FieldMeta *field, s64 raw)
+{
+    return ((double)raw * (double)field->lsb_num) / (double)field->lsb_den;
+}
+#endif
+
+/** @brief Label of a value of an enumerated field.
+ *
+ * @param[in] field Description of the field (must not be NULL)
+ * @param[in] raw Raw value, as read by field_read()
+ * @return Label of the value, or NULL if the field has none for it
+ */
+ASTERIX_LIB const char *field_label(const FieldMeta *field, s64 raw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIELD_H */
@@ -4,7 +4,9 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include <Common/config.h>
 #include <Common/visibility.h>
+#include <Common/common_types.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,11 +26,163 @@ typedef int64_t s64;
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/*
+ * Packed enumerations
+ *
+ * A C enum usually takes 4 octets. Compact layouts store enumerated fields as
+ * ASTERIX_ENUM8(<enum type>): one octet holding a value of that enum, which
+ * converts implicitly both ways.
+ */
+#define ASTERIX_ENUM8(ENUM_T)   u8
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Scaled fields
+ *
+ * Fields quantised with an LSB are declared as ASTERIX_SCALED(<raw type>): a
+ * float in engineering units by default, or the raw LSB count itself with
+ * ASTERIX_RAW_FIELDS. ASTERIX_SCALED_ACCESSORS() then defines, for the field
+ * FIELD of the item TYPE:
+ *
+ * - get_<TYPE>_<FIELD>_raw() / set_<TYPE>_<FIELD>_raw(): raw LSB count (always)
+ * - get_<TYPE>_<FIELD>() / set_<TYPE>_<FIELD>(): engineering units (unless
+ *   ASTERIX_NO_FLOAT)
+ *
+ * Codecs only use the raw accessors, so they are the same in every mode.
+ * Conversions are exact multiplications by LSB (raw to units) and by its
+ * reciprocal SCALE (units to raw, rounded to the nearest LSB).
+ */
+
+#ifdef ASTERIX_RAW_FIELDS
+    #define ASTERIX_SCALED(RAW_T)   RAW_T
+#else
+    #define ASTERIX_SCALED(RAW_T)   float
+#endif
+
+#ifndef ASTERIX_NO_FLOAT
+/**
+ * @brief Convert a value in engineering units to the nearest raw LSB count
+ *
+ * @param value Value in engineering units
+ * @param scale Reciprocal of the LSB of the field
+ */
+static inline s64 bs_units_to_raw(double value, double scale)
+{
+    double raw = value * scale;
+    return (s64)((raw < 0.0) ? (raw - 0.5) : (raw + 0.5));
+}
+#endif /* ASTERIX_NO_FLOAT */
+
+#define ASTERIX_RAW_ACCESSORS_(TYPE, FIELD, RAW_T)                              \
+    static inline RAW_T get_##TYPE##_##FIELD##_raw(const TYPE * item)           \
+    {                                                                           \
+        return item->FIELD;                                                     \
+    }                                                                           \
+    static inline void set_##TYPE##_##FIELD##_raw(TYPE * item, RAW_T raw)       \
+    {                                                                           \
+        item->FIELD = raw;                                                      \
+    }
+
+#if defined(ASTERIX_NO_FLOAT)
+    #define ASTERIX_SCALED_ACCESSORS(TYPE, FIELD, RAW_T, LSB, SCALE)            \
+        ASTERIX_RAW_ACCESSORS_(TYPE, FIELD, RAW_T)
+#elif defined(ASTERIX_RAW_FIELDS)
+    #define ASTERIX_SCALED_ACCESSORS(TYPE, FIELD, RAW_T, LSB, SCALE)            \
+        ASTERIX_RAW_ACCESSORS_(TYPE, FIELD, RAW_T)                              \
+        static inline float get_##TYPE##_##FIELD(const TYPE * item)             \
+        {                                                                       \
+            return (float)((double)item->FIELD * (LSB));                        \
+        }                                                                       \
+        static inline void set_##TYPE##_##FIELD(TYPE * item, float value)       \
+        {                                                                       \
+            item->FIELD = (RAW_T)bs_units_to_raw((double)value, (SCALE));       \
+        }
+#else
+    #define ASTERIX_SCALED_ACCESSORS(TYPE, FIELD, RAW_T, LSB, SCALE)            \
+        static inline RAW_T get_##TYPE##_##FIELD##_raw(const TYPE * item)       \
+        {                                                                       \
+            return (RAW_T)bs_units_to_raw((double)item->FIELD, (SCALE));        \
+        }                                                                       \
+        static inline void set_##TYPE##_##FIELD##_raw(TYPE * item, RAW_T raw)   \
+        {                                                                       \
+            item->FIELD = (float)((double)raw * (LSB));                         \
+        }                                                                       \
+        static inline float get_##TYPE##_##FIELD(const TYPE * item)             \
+        {                                                                       \
+            return item->FIELD;                                                 \
+        }                                                                       \
+        static inline void set_##TYPE##_##FIELD(TYPE * item, float value)       \
+        {                                                                       \
+            item->FIELD = value;                                                \
+        }
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief One contiguous piece of a non-contiguous buffer (iovec-like)
+ */
+typedef struct {
+    u8 *    data;
+    size_t  len;
+} BitStreamSegment;
+
+/**
+ * @brief Bounded, caller-owned storage for the variable parts of decoded items
+ *
+ * Repetitive items reference their entries in the decoded buffer. When an
+ * arena is attached to the BitStream (see bs_set_arena()), the entries are
+ * copied into it instead, so the decoded record no longer depends on the
+ * buffer; the arena is then reset by the caller, e.g. once per data block.
+ */
+typedef struct {
+    u8 *    data;
+    size_t  size;
+    /// @brief Octets handed out since the last reset
+    size_t  used;
+} AsterixArena;
+
+static inline void arena_init(AsterixArena * arena, u8 * data, size_t size)
+{
+    arena->data = data;
+    arena->size = size;
+    arena->used = 0U;
+}
+static inline void arena_reset(AsterixArena * arena)
+{
+    arena->used = 0U;
+}
+
+/**
+ * @brief Bit-level cursor over a contiguous buffer or a chain of segments
+ *
+ * Positions (byte_pos, limit, buffer_size) are always absolute offsets in the
+ * logical stream. `buffer` points to the segment currently in use, which
+ * covers the offsets [seg_start, seg_start + seg_len); a plain buffer is the
+ * single segment [0, buffer_size).
+ */
 typedef struct {
     u8 *    buffer;
     size_t  buffer_size;
     size_t  byte_pos;
     size_t  bit_pos;
+    /// @brief End of the readable/writable data (buffer_size, or LEN once validated)
+    size_t  limit;
+    /// @brief Sticky error state (see bs_require())
+    eAsterixStatus status;
+    /// @brief Segment chain (NULL for a contiguous buffer)
+    const BitStreamSegment * segs;
+    /// @brief Number of segments in the chain
+    size_t  n_segs;
+    /// @brief Index of the segment currently in use
+    size_t  seg_idx;
+    /// @brief Absolute offset of the first octet of the current segment
+    size_t  seg_start;
+    /// @brief Length of the current segment
+    size_t  seg_len;
+    /// @brief Storage for the variable parts of decoded items (NULL: reference the data)
+    AsterixArena * arena;
 } BitStream;
 
 ASTERIX_LIB inline void bs_init(BitStream * bs, u8 * buffer, size_t buffer_size)
@@ -37,16 +191,98 @@ ASTERIX_LIB inline void bs_init(BitStream * bs, u8 * buffer, size_t buffer_size)
     bs->buffer_size = buffer_size;
     bs->byte_pos    = 3; /* Start at 3 to write CAT and LEN last */
     bs->bit_pos     = 0;
+    bs->limit       = buffer_size;
+    bs->status      = eAsterixStatus_OK;
+    bs->segs        = NULL;
+    bs->n_segs      = 0U;
+    bs->seg_idx     = 0U;
+    bs->seg_start   = 0U;
+    bs->seg_len     = buffer_size;
+    bs->arena       = NULL;
+}
+
+/**
+ * @brief Initialise a BitStream positioned at any octet of the buffer
+ *
+ * The buffer starts with the header of its data block (CAT and LEN are
+ * always read at offsets 0 to 2), and pos is e.g. the offset of one of its
+ * records as reported by record_iter_next().
+ *
+ * @param[out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] buffer Data block (must not be NULL)
+ * @param[in] buffer_size Size of the buffer in octets
+ * @param[in] pos Offset of the first octet to read or write
+ */
+static inline void bs_init_at(BitStream * bs, u8 * buffer, size_t buffer_size, size_t pos)
+{
+    bs_init(bs, buffer, buffer_size);
+    bs->byte_pos = pos;
+}
+
+/**
+ * @brief Initialise a BitStream over a chain of segments
+ *
+ * The segments are read/written in order as one logical buffer, e.g. the two
+ * halves of a ring buffer that wrapped in the middle of a data block. The
+ * array (not only the data it points to) must outlive the BitStream.
+ *
+ * @param[out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] segs Array of segments (must not be NULL)
+ * @param[in] n_segs Number of segments (at least 1)
+ */
+ASTERIX_LIB void bs_init_segments(BitStream * bs, const BitStreamSegment * segs, size_t n_segs);
+
+/**
+ * @brief Copy the variable parts of decoded items (see AsterixArena) into arena
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] arena Arena to copy into, or NULL to reference the data in place
+ */
+static inline void bs_set_arena(BitStream * bs, AsterixArena * arena)
+{
+    bs->arena = arena;
 }
 ASTERIX_LIB inline void bs_inc_pos(BitStream * bs, size_t byte_inc, size_t bit_inc)
 {
-    bs->byte_pos += byte_inc;
     bs->bit_pos  += bit_inc;
-    if (bs->bit_pos == 8)
+    bs->byte_pos += byte_inc + (bs->bit_pos >> 3U);
+    bs->bit_pos  &= 7U;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Bounds checking
+ *
+ * Checks are done per item (or per variable part of an item) against `limit`,
+ * never per field: the codecs call bs_require() with the number of octets
+ * they are about to touch and then run unchecked. A failed check latches the
+ * error in `status`, which the category codecs return to the caller.
+ */
+
+static inline eAsterixStatus bs_status(const BitStream * bs)
+{
+    return bs->status;
+}
+static inline void bs_set_error(BitStream * bs, eAsterixStatus status)
+{
+    if (bs->status == eAsterixStatus_OK)
+    {
+        bs->status = status;
+    }
+}
+static inline eBoolean bs_require(BitStream * bs, size_t n_bytes)
+{
+    if (bs->status != eAsterixStatus_OK)
     {
-        bs->byte_pos++;
-        bs->bit_pos = 0;
+        return eBoolean_FALSE;
     }
+    if ((bs->byte_pos + n_bytes) > bs->limit)
+    {
+        bs->status = eAsterixStatus_ERR_OVERRUN;
+        return eBoolean_FALSE;
+    }
+    return eBoolean_TRUE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -54,15 +290,127 @@ ASTERIX_LIB inline void bs_inc_pos(BitStream * bs, size_t byte_inc, size_t bit_i
 void _bs_serialize(BitStream * bs, u64 value, size_t n_bits);
 u64  _bs_deserialize(BitStream * bs, size_t n_bits);
 
+/* Slow paths: copy octets at any absolute offset, across segment boundaries */
+void _bs_gather(BitStream * bs, size_t pos, u8 * dst, size_t n_bytes);
+void _bs_scatter(BitStream * bs, size_t pos, const u8 * src, size_t n_bytes);
+const u8 * _bs_ref(BitStream * bs, size_t n_bytes);
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Segment fast path
+ *
+ * A field lying entirely inside the current segment is accessed in place;
+ * otherwise it is staged in a small caller-provided buffer and copied across
+ * the boundary by the slow path. For a contiguous buffer the fast path is
+ * always taken within buffer_size.
+ */
+
+static inline u8 * bs_fast_ptr(const BitStream * bs, size_t pos, size_t n_bytes)
+{
+    size_t off = pos - bs->seg_start; /* Wraps (fails the check) if pos < seg_start */
+    return ((off <= bs->seg_len) && (n_bytes <= (bs->seg_len - off))) ? &bs->buffer[off] : NULL;
+}
+static inline const u8 * bs_read_ptr(BitStream * bs, u8 * tmp, size_t n_bytes)
+{
+    const u8 * p = bs_fast_ptr(bs, bs->byte_pos, n_bytes);
+    if (p == NULL)
+    {
+        _bs_gather(bs, bs->byte_pos, tmp, n_bytes);
+        p = tmp;
+    }
+    bs->byte_pos += n_bytes;
+    return p;
+}
+/**
+ * @brief Lasting reference to the next n_bytes octets, which are consumed
+ *
+ * Points into the data itself, or into the arena of the BitStream if one is
+ * attached or the octets straddle two segments. Returns NULL (and latches
+ * eAsterixStatus_ERR_ARENA) if they do not fit in the arena; the caller
+ * checks the octets are within the data with bs_require().
+ */
+static inline const u8 * bs_ref_ptr(BitStream * bs, size_t n_bytes)
+{
+    const u8 * p = bs_fast_ptr(bs, bs->byte_pos, n_bytes);
+    if ((p == NULL) || (bs->arena != NULL))
+    {
+        return _bs_ref(bs, n_bytes);
+    }
+    bs->byte_pos += n_bytes;
+    return p;
+}
+static inline u8 * bs_write_ptr(BitStream * bs, u8 * tmp, size_t n_bytes)
+{
+    u8 * p = bs_fast_ptr(bs, bs->byte_pos, n_bytes);
+    return (p != NULL) ? p : tmp;
+}
+static inline void bs_write_done(BitStream * bs, const u8 * p, const u8 * tmp, size_t n_bytes)
+{
+    if (p == tmp)
+    {
+        _bs_scatter(bs, bs->byte_pos, tmp, n_bytes);
+    }
+    bs->byte_pos += n_bytes;
+}
+
+/* Octet at `offset` octets from the (octet-aligned) current position, without
+ * moving it; the caller checks it is within the data with bs_require() */
+static inline u8 bs_peek_aligned_u8(BitStream * bs, size_t offset)
+{
+    u8 tmp = 0U;
+    const u8 * p = bs_fast_ptr(bs, bs->byte_pos + offset, 1U);
+    if (p == NULL)
+    {
+        _bs_gather(bs, bs->byte_pos + offset, &tmp, 1U);
+        p = &tmp;
+    }
+    return *p;
+}
+
+/* Big-endian values of the octets at p, for the items read from their raw
+ * octets (see UapReadFn); the caller checks they are within the data */
+static inline u16 bs_load_u16(const u8 * p)
+{
+    return (u16)(((u16)p[0U] << 8U) | (u16)p[1U]);
+}
+static inline u32 bs_load_u24(const u8 * p)
+{
+    return ((u32)p[0U] << 16U) | ((u32)p[1U] << 8U) | (u32)p[2U];
+}
+static inline s32 bs_load_s24(const u8 * p)
+{
+    /* Sign extension of the two's complement 24-bit value */
+    return (s32)(bs_load_u24(p) ^ 0x800000U) - (s32)0x800000;
+}
+
+/* Move over n_bytes octets without reading them, if they are within the data */
+static inline void bs_skip(BitStream * bs, size_t n_bytes)
+{
+    if (bs_require(bs, n_bytes))
+    {
+        bs->byte_pos += n_bytes;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ASTERIX_LIB static inline void bs_serialize_cat(BitStream * bs, u8 cat)
 {
-    bs->buffer[0U] = cat;
+    u8 * p = bs_fast_ptr(bs, 0U, 1U);
+    if (p != NULL)
+        p[0U] = cat;
+    else
+        _bs_scatter(bs, 0U, &cat, 1U);
 }
 ASTERIX_LIB static inline u8 bs_deserialize_cat(BitStream * bs)
 {
-    return bs->buffer[0U];
+    u8 cat = 0U;
+    const u8 * p = bs_fast_ptr(bs, 0U, 1U);
+    if (p != NULL)
+        return p[0U];
+    _bs_gather(bs, 0U, &cat, 1U);
+    return cat;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -70,12 +418,32 @@ ASTERIX_LIB static inline u8 bs_deserialize_cat(BitStream * bs)
 ASTERIX_LIB static inline void bs_serialize_len(BitStream * bs)
 {
     size_t len = bs->byte_pos + (bs->bit_pos ? 1U : 0U);
-    bs->buffer[1U] = (u8)((len >> 8U) & 0xFFU);
-    bs->buffer[2U] = (u8)(len & 0xFFU);
+    u8 raw[2U];
+    u8 * p = bs_fast_ptr(bs, 1U, 2U);
+
+    raw[0U] = (u8)((len >> 8U) & 0xFFU);
+    raw[1U] = (u8)(len & 0xFFU);
+    if (p != NULL)
+    {
+        p[0U] = raw[0U];
+        p[1U] = raw[1U];
+    }
+    else
+    {
+        _bs_scatter(bs, 1U, raw, 2U);
+    }
 }
 ASTERIX_LIB static inline u16 bs_deserialize_len(BitStream * bs)
 {
-    return ((u16)bs->buffer[1U] << 8U) | (u16)bs->buffer[2U];
+    u8 raw[2U];
+    const u8 * p = bs_fast_ptr(bs, 1U, 2U);
+
+    if (p == NULL)
+    {
+        _bs_gather(bs, 1U, raw, 2U);
+        p = raw;
+    }
+    return (u16)(((u16)p[0U] << 8U) | (u16)p[1U]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -86,6 +454,32 @@ ASTERIX_LIB static inline void bs_serialize_header(BitStream * bs, u8 cat)
     bs_serialize_len(bs);
 }
 
+/**
+ * @brief Validate the header of the data block once before decoding it
+ *
+ * Checks that the buffer holds a full header and that LEN neither exceeds
+ * the buffer nor is shorter than the header itself, then restricts the
+ * stream to the LEN octets of the block.
+ */
+static inline eAsterixStatus bs_validate_block(BitStream * bs)
+{
+    u16 len = 0U;
+
+    if (bs->buffer_size < 3U)
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_LEN);
+        return bs->status;
+    }
+    len = bs_deserialize_len(bs);
+    if ((len < 3U) || (len > bs->buffer_size))
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_LEN);
+        return bs->status;
+    }
+    bs->limit = len;
+    return bs->status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ASTERIX_LIB static inline void bs_serialize_u8(BitStream * bs, u8 value, size_t n_bits)
@@ -164,42 +558,164 @@ ASTERIX_LIB static inline s64 bs_deserialize_s64(BitStream * bs, size_t n_bits)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/*
+ * Byte-aligned accessors
+ *
+ * Straight-line big-endian codecs for fields that start on an octet boundary
+ * (bit_pos == 0) and span whole octets, which is the case for every fixed
+ * length ASTERIX item and for most of their fields. They bypass the
+ * bit-granular engine entirely; fields packing sub-octet values must keep
+ * using the bs_serialize_*()/bs_deserialize_*() functions above.
+ */
+
+static inline void bs_serialize_aligned_u8(BitStream * bs, u8 value)
+{
+    u8 tmp[1U];
+    u8 * p = bs_write_ptr(bs, tmp, 1U);
+    p[0U] = value;
+    bs_write_done(bs, p, tmp, 1U);
+}
+static inline u8 bs_deserialize_aligned_u8(BitStream * bs)
+{
+    u8 tmp[1U];
+    const u8 * p = bs_read_ptr(bs, tmp, 1U);
+    return p[0U];
+}
+static inline void bs_serialize_aligned_s8(BitStream * bs, s8 value)
+{
+    bs_serialize_aligned_u8(bs, (u8)value);
+}
+static inline s8 bs_deserialize_aligned_s8(BitStream * bs)
+{
+    return (s8)bs_deserialize_aligned_u8(bs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static inline void bs_serialize_aligned_u16(BitStream * bs, u16 value)
+{
+    u8 tmp[2U];
+    u8 * p = bs_write_ptr(bs, tmp, 2U);
+    p[0U] = (u8)(value >> 8U);
+    p[1U] = (u8)(value);
+    bs_write_done(bs, p, tmp, 2U);
+}
+static inline u16 bs_deserialize_aligned_u16(BitStream * bs)
+{
+    u8 tmp[2U];
+    return bs_load_u16(bs_read_ptr(bs, tmp, 2U));
+}
+static inline void bs_serialize_aligned_s16(BitStream * bs, s16 value)
+{
+    bs_serialize_aligned_u16(bs, (u16)value);
+}
+static inline s16 bs_deserialize_aligned_s16(BitStream * bs)
+{
+    return (s16)bs_deserialize_aligned_u16(bs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static inline void bs_serialize_aligned_u24(BitStream * bs, u32 value)
+{
+    u8 tmp[3U];
+    u8 * p = bs_write_ptr(bs, tmp, 3U);
+    p[0U] = (u8)(value >> 16U);
+    p[1U] = (u8)(value >> 8U);
+    p[2U] = (u8)(value);
+    bs_write_done(bs, p, tmp, 3U);
+}
+static inline u32 bs_deserialize_aligned_u24(BitStream * bs)
+{
+    u8 tmp[3U];
+    return bs_load_u24(bs_read_ptr(bs, tmp, 3U));
+}
+static inline void bs_serialize_aligned_s24(BitStream * bs, s32 value)
+{
+    bs_serialize_aligned_u24(bs, (u32)value);
+}
+static inline s32 bs_deserialize_aligned_s24(BitStream * bs)
+{
+    u8 tmp[3U];
+    return bs_load_s24(bs_read_ptr(bs, tmp, 3U));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static inline void bs_serialize_aligned_u32(BitStream * bs, u32 value)
+{
+    u8 tmp[4U];
+    u8 * p = bs_write_ptr(bs, tmp, 4U);
+    p[0U] = (u8)(value >> 24U);
+    p[1U] = (u8)(value >> 16U);
+    p[2U] = (u8)(value >> 8U);
+    p[3U] = (u8)(value);
+    bs_write_done(bs, p, tmp, 4U);
+}
+static inline u32 bs_deserialize_aligned_u32(BitStream * bs)
+{
+    u8 tmp[4U];
+    const u8 * p = bs_read_ptr(bs, tmp, 4U);
+    return ((u32)p[0U] << 24U) | ((u32)p[1U] << 16U) | ((u32)p[2U] << 8U) | (u32)p[3U];
+}
+static inline void bs_serialize_aligned_s32(BitStream * bs, s32 value)
+{
+    bs_serialize_aligned_u32(bs, (u32)value);
+}
+static inline s32 bs_deserialize_aligned_s32(BitStream * bs)
+{
+    return (s32)bs_deserialize_aligned_u32(bs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASTERIX_NO_FLOAT
+
+/* Sign-extend the n_bits two's complement value read from the stream */
+static inline s64 bs_sign_extend(u64 value, size_t n_bits)
+{
+    u64 sign = (u64)1U << (n_bits - 1U);
+    return (s64)(value ^ sign) - (s64)sign;
+}
+
 ASTERIX_LIB static inline void bs_serialize_ufloat(BitStream * bs, float value, float step, size_t n_bits)
 {
-    _bs_serialize(bs, (u64)(value / step), n_bits);
+    _bs_serialize(bs, (u64)bs_units_to_raw((double)value, 1.0 / (double)step), n_bits);
 }
 ASTERIX_LIB static inline float bs_deserialize_ufloat(BitStream * bs, float step, size_t n_bits)
 {
-    return (float)(_bs_deserialize(bs, n_bits) * step);
+    return (float)((double)_bs_deserialize(bs, n_bits) * (double)step);
 }
 ASTERIX_LIB static inline void bs_serialize_sfloat(BitStream * bs, float value, float step, size_t n_bits)
 {
-    _bs_serialize(bs, (u64)((s64)(value / step)), n_bits);
+    _bs_serialize(bs, (u64)bs_units_to_raw((double)value, 1.0 / (double)step), n_bits);
 }
 ASTERIX_LIB static inline float bs_deserialize_sfloat(BitStream * bs, float step, size_t n_bits)
 {
-    return (float)(((s64)_bs_deserialize(bs, n_bits)) * step);
+    return (float)((double)bs_sign_extend(_bs_deserialize(bs, n_bits), n_bits) * (double)step);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
 ASTERIX_LIB static inline void bs_serialize_udouble(BitStream * bs, double value, double step, size_t n_bits)
 {
-    _bs_serialize(bs, (u64)(value / step), n_bits);
+    _bs_serialize(bs, (u64)bs_units_to_raw(value, 1.0 / step), n_bits);
 }
 ASTERIX_LIB static inline double bs_deserialize_udouble(BitStream * bs, double step, size_t n_bits)
 {
-    return (double)(_bs_deserialize(bs, n_bits) * step);
+    return (double)_bs_deserialize(bs, n_bits) * step;
 }
 ASTERIX_LIB static inline void bs_serialize_sdouble(BitStream * bs, double value, double step, size_t n_bits)
 {
-    _bs_serialize(bs, (u64)((s64)(value / step)), n_bits);
+    _bs_serialize(bs, (u64)bs_units_to_raw(value, 1.0 / step), n_bits);
 }
 ASTERIX_LIB static inline double bs_deserialize_sdouble(BitStream * bs, double step, size_t n_bits)
 {
-    return (double)(((s64)_bs_deserialize(bs, n_bits)) * step);
+    return (double)bs_sign_extend(_bs_deserialize(bs, n_bits), n_bits) * step;
 }
 
+#endif /* ASTERIX_NO_FLOAT */
+
 ////////////////////////////////////////////////////////////////////////////////
 
 #ifdef __cplusplus
@@ -0,0 +1,497 @@
+/**
+ * @file uap.h
+ * @brief Generic User Application Profile (UAP) engine
+ *
+ * A category describes its UAP once, as a static table of items indexed by
+ * Field Reference Number (FRN), and the engine walks the FSPEC and the items
+ * of every record through that table. Presence of the items is carried as a
+ * 64-bit mask where bit (FRN - 1) is set for every present item.
+ */
+
+#ifndef UAP_H
+#define UAP_H
+
+#include <Infra/infra.h>
+#include <Common/common_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ================================= MACROS ================================= */
+
+/// @brief Max. number of FSPEC octets (7 FRNs each) held by a presence mask
+#define UAP_FSPEC_MAX_OCTETS    8U
+
+/// @brief Max. number of FRNs of a UAP
+#define UAP_MAX_FRN             (7U * UAP_FSPEC_MAX_OCTETS)
+
+/// @brief Presence mask bit of the given FRN (1-based)
+#define UAP_FRN_BIT(FRN)        ((u64)1U << ((FRN) - 1U))
+
+/// @brief Number of decode plans cached per thread (power of 2)
+#ifndef UAP_PLAN_CACHE_SIZE
+    #define UAP_PLAN_CACHE_SIZE 32U
+#endif
+
+/// @brief Max. number of items of a cacheable decode plan
+#define UAP_PLAN_MAX_ITEMS      32U
+
+/// @brief Presence mask of FRNs 1 to N (N <= UAP_MAX_FRN)
+#define UAP_FRN_UPTO(N)         (((u64)1U << (N)) - 1U)
+
+/* ================================= ENUMS ================================= */
+
+/**
+ * @brief Length format of a data item
+ */
+typedef enum eUapItemKind
+{
+    eUapItemKind_FIXED = 0,     /* Fixed length, checked by the engine */
+    eUapItemKind_EXTENDED,      /* Primary part plus FX-chained extensions */
+    eUapItemKind_REPETITIVE,    /* REP octet followed by REP fixed parts */
+    eUapItemKind_COMPOUND,      /* Primary subfield plus present subfields */
+    eUapItemKind_EXPLICIT,      /* LEN octet followed by LEN - 1 octets */
+} eUapItemKind;
+
+/* ================================= STRUCTS ================================= */
+
+/// @brief Item encoder: writes the structure pointed by item
+typedef void (*UapEncodeFn)(BitStream *bs, const void *item);
+
+/// @brief Item decoder: fills the structure pointed by item
+typedef void (*UapDecodeFn)(BitStream *bs, void *item);
+
+/// @brief Item length: octets of the item at the current position, 0 on error
+typedef size_t (*UapLengthFn)(BitStream *bs);
+
+/// @brief Item size: octets the structure pointed by item is encoded into
+typedef size_t (*UapSizeFn)(const void *item);
+
+/// @brief Fixed-length item decoder from its raw octets, checked by the caller
+typedef void (*UapReadFn)(const u8 *data, void *item);
+
+/**
+ * @brief One entry (FRN) of a UAP
+ *
+ * Spare FRNs have NULL codecs: an FSPEC referencing them is rejected.
+ */
+typedef struct UapItem
+{
+    /// @brief Name of the data item (e.g. "I034/010")
+    const char *    name;
+    /// @brief Length format of the data item
+    eUapItemKind    kind;
+    /// @brief Length in octets of eUapItemKind_FIXED items (0 otherwise)
+    size_t          len;
+    /// @brief Offset of the item structure inside the record structure
+    size_t          offset;
+    UapEncodeFn     encode;
+    UapDecodeFn     decode;
+    /// @brief Length of the item from its raw octets, without decoding it
+    UapLengthFn     length;
+    /// @brief Length of the item once encoded, without encoding it
+    UapSizeFn       size;
+    /// @brief Decoder of eUapItemKind_FIXED items from their octets (NULL otherwise)
+    UapReadFn       read;
+} UapItem;
+
+/**
+ * @brief Location of one data item inside the raw octets of a record
+ *
+ * Records never exceed the 16-bit LEN of their data block, so offsets and
+ * lengths are kept in 16 bits to make per-record indexes cheap to copy.
+ */
+typedef struct UapItemRef
+{
+    /// @brief FRN of the item (0 if the item is not present)
+    u8      frn;
+    /// @brief Position of the first octet of the item in the BitStream
+    u16     offset;
+    /// @brief Length of the item in octets
+    u16     length;
+} UapItemRef;
+
+/**
+ * @brief User Application Profile of a category
+ */
+typedef struct Uap
+{
+    /// @brief Category number
+    u8              cat;
+    /// @brief Number of FRNs described (at most UAP_MAX_FRN)
+    size_t          n_frn;
+    /// @brief Items indexed by FRN - 1
+    const UapItem * items;
+    /// @brief Presence mask of the FRNs with an item (the rest are spare)
+    u64             valid;
+} Uap;
+
+/**
+ * @brief Record written item by item, without a record structure
+ *
+ * uap_builder_begin() reserves one FSPEC octet, the items are written right
+ * after it as they come (see uap_builder_put()), and uap_builder_end() writes
+ * the FSPEC of the items actually written over the reserved octets. The first
+ * item past the reserved octets (FRN above 7 * reserved) moves the items
+ * written so far forward once to make room (see uap_builder_grow()).
+ */
+typedef struct UapBuilder
+{
+    /// @brief BitStream the record is written to
+    BitStream *     bs;
+    /// @brief UAP of the category
+    const Uap *     uap;
+    /// @brief Position of the first octet of the FSPEC
+    size_t          start;
+    /// @brief Number of FSPEC octets reserved
+    size_t          reserved;
+    /// @brief Presence mask of the items written so far (bit FRN - 1)
+    u64             present;
+    /// @brief FRN of the last item written (0 before the first)
+    u8              last_frn;
+} UapBuilder;
+
+/**
+ * @brief Decode plan of one FSPEC pattern of a UAP
+ *
+ * Items are listed in wire order. The first n_fixed are fixed-length items
+ * at known offsets from the end of the FSPEC, so they are checked at once
+ * (fixed_len) and read from their octets (see UapItem::read) with no
+ * presence or length test. uap_encoded_size() also counts them at once
+ * when the pattern is already cached, without counting the lookup in
+ * UapPlanStats nor caching a plan.
+ */
+typedef struct UapPlan
+{
+    /// @brief UAP the plan belongs to (NULL for a free cache slot)
+    const Uap * uap;
+    /// @brief Presence mask the plan was built for
+    u64         present;
+    /// @brief Number of items present
+    u8          n_items;
+    /// @brief Number of leading fixed-length items
+    u8          n_fixed;
+    /// @brief Total length of the leading fixed-length items
+    u16         fixed_len;
+    /// @brief FRN - 1 of each item, in wire order
+    u8          index[UAP_PLAN_MAX_ITEMS];
+    /// @brief Offset of each leading fixed-length item from the end of the FSPEC
+    u16         offset[UAP_PLAN_MAX_ITEMS];
+} UapPlan;
+
+/**
+ * @brief Statistics of the decode plan cache of the calling thread
+ */
+typedef struct UapPlanStats
+{
+    /// @brief Records decoded with a cached plan
+    u64 hits;
+    /// @brief Records that had to build their plan
+    u64 misses;
+    /// @brief Cached plans replaced by another FSPEC pattern
+    u64 evictions;
+} UapPlanStats;
+
+/* ============================== EXTRA FUNCS ============================== */
+
+/**
+ * @brief Index of the lowest bit set (mask must not be 0), i.e. FRN - 1 of
+ * the first present item
+ */
+static inline size_t uap_ctz64(u64 mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_ctzll(mask);
+#else
+    size_t n = 0U;
+
+    while ((mask & 1U) == 0U)
+    {
+        mask >>= 1U;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Number of bits set, i.e. number of present items
+ */
+static inline size_t uap_popcount64(u64 mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_popcountll(mask);
+#else
+    size_t n = 0U;
+
+    for (; mask != 0U; mask &= mask - 1U)
+        n++;
+    return n;
+#endif
+}
+
+/**
+ * @brief Number of octets of the shortest FSPEC holding the presence mask
+ */
+static inline size_t uap_fspec_octets(u64 present)
+{
+    size_t n_octets = 1U;
+
+    while ((n_octets < UAP_FSPEC_MAX_OCTETS) && ((present >> (7U * n_octets)) != 0U))
+        n_octets++;
+    return n_octets;
+}
+
+/* =============================== DE/ENCODE =============================== */
+
+/** @brief Write the shortest FX-chained presence octets holding a mask.
+ *
+ * Shared by the FSPEC of records and the primary subfield of compound items
+ * (see Infra/compound.h): octet i carries bits 7i to 7i+6 of the mask.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] present Presence mask
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_write_presence(BitStream *bs, u64 present);
+
+/** @brief Read FX-chained presence octets at the current position, without moving it.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[out] present Presence mask (0 on error)
+ * @return Number of presence octets, or 0 on error (see bs_status())
+ */
+ASTERIX_LIB size_t uap_peek_presence(BitStream *bs, u64 *present);
+
+/** @brief Write the shortest FSPEC holding the given presence mask.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask (bit FRN - 1)
+ * @return eAsterixStatus_OK, eAsterixStatus_ERR_FSPEC if an FRN with no item
+ * is present, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_encode_fspec(BitStream *bs, const Uap *uap, u64 present);
+
+/** @brief Read an FSPEC and convert it to a presence mask.
+ *
+ * The whole FX chain is located in one pass (see asterix_fx_scan()) and
+ * converted octet by octet, so the cost does not depend on the items present.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[out] present Presence mask (bit FRN - 1)
+ * @return eAsterixStatus_OK, eAsterixStatus_ERR_FSPEC if an FRN with no item
+ * is present, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_decode_fspec(BitStream *bs, const Uap *uap, u64 *present);
+
+/** @brief Encode the present items of a record, in FRN order.
+ *
+ * Only the present items are visited (count-trailing-zeros iteration).
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask (bit FRN - 1)
+ * @param[in] record Record structure holding the items at UapItem::offset
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_encode_items(BitStream *bs, const Uap *uap, u64 present, const void *record);
+
+/** @brief Length in octets of a record once encoded, without encoding it.
+ *
+ * Fixed-length items are counted from the UAP, the leading ones at once from
+ * the plan of the FSPEC pattern if a decode already cached it (see
+ * UapPlan::fixed_len), and the others are measured from their structure (see
+ * UapItem::size). The plan cache and its statistics are left untouched.
+ *
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask (bit FRN - 1)
+ * @param[in] record Record structure holding the items at UapItem::offset
+ * @return Length of the FSPEC and of the present items, or 0 if an FRN with
+ * no item is present or an item cannot be measured
+ */
+ASTERIX_LIB size_t uap_encoded_size(const Uap *uap, u64 present, const void *record);
+
+/** @brief Decode the present items of a record, in FRN order.
+ *
+ * The items are decoded following the plan cached for the FSPEC pattern
+ * (see uap_plan()), so that recurring patterns (north markers, sector
+ * crossings...) only pay for the presence mask once.
+ *
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask (bit FRN - 1), as read by uap_decode_fspec()
+ * @param[in/out] record Record structure holding the items at UapItem::offset
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_decode_items(BitStream *bs, const Uap *uap, u64 present, void *record);
+
+/** @brief Decode the present items of a record that are also wanted, skipping the others.
+ *
+ * The record goes through the plan cached for its FSPEC pattern, as with
+ * uap_decode_items(): the leading fixed items outside wanted are passed over
+ * by their offset in the plan, the others outside wanted are measured from
+ * their raw octets (see UapItem::length) and skipped without being decoded,
+ * so the BitStream ends past the record. The skipped items of record are
+ * left untouched.
+ *
+ * @param[in/out] bs Pointer to the BitStream, past the FSPEC (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask (bit FRN - 1), as read by uap_decode_fspec()
+ * @param[in] wanted Items to decode (bit FRN - 1)
+ * @param[in/out] record Record structure holding the items at UapItem::offset
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_decode_selected(BitStream *bs, const Uap *uap, u64 present, u64 wanted, void *record);
+
+/** @brief Locate the present items of a record, in FRN order, without decoding them.
+ *
+ * Every present item is measured from its raw octets (see UapItem::length)
+ * and skipped, so the BitStream ends past the record. Absent items are left
+ * with refs[FRN - 1].frn set to 0.
+ *
+ * @param[in/out] bs Pointer to the BitStream, past the FSPEC (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask (bit FRN - 1), as read by uap_decode_fspec()
+ * @param[out] refs Location of each item, indexed by FRN - 1 (uap->n_frn entries)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_index_items(BitStream *bs, const Uap *uap, u64 present, UapItemRef *refs);
+
+/** @brief Move the BitStream past the items of a record without decoding them.
+ *
+ * Same walk as uap_index_items(), without recording where the items are:
+ * used to find where the next record of a data block starts.
+ *
+ * @param[in/out] bs Pointer to the BitStream, past the FSPEC (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask (bit FRN - 1), as read by uap_decode_fspec()
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_skip_items(BitStream *bs, const Uap *uap, u64 present);
+
+/* ================================ BUILDER ================================ */
+
+/** @brief Start a record at the current position of the BitStream.
+ *
+ * @param[out] builder Builder of the record (must not be NULL)
+ * @param[in/out] bs Pointer to the BitStream (must not be NULL)
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_builder_begin(UapBuilder *builder, BitStream *bs, const Uap *uap);
+
+/** @brief Reserve the FSPEC octets an FRN needs, past those already reserved.
+ *
+ * The items written so far are moved forward over the new octets. Called by
+ * uap_builder_put() only, for the first item of each new FSPEC octet.
+ *
+ * @param[in/out] builder Builder of the record (must not be NULL)
+ * @param[in] frn FRN of the item about to be written
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_builder_grow(UapBuilder *builder, u8 frn);
+
+/** @brief Announce the next item of a record, known to be in its UAP.
+ *
+ * As uap_builder_put(), for callers that know the item is in the UAP and its
+ * length: the category builders, whose FRN and length are constants.
+ *
+ * @param[in/out] builder Builder of the record (must not be NULL)
+ * @param[in] frn FRN of the item, in the UAP
+ * @param[in] len Length in octets of a fixed-length item, checked against the
+ * buffer here (0 for the others, which check their own length)
+ * @return eBoolean_TRUE if the item is to be written, eBoolean_FALSE with the
+ * error latched in the BitStream otherwise (eAsterixStatus_ERR_ORDER if frn
+ * does not follow the last item)
+ */
+static inline eBoolean uap_builder_next(UapBuilder *builder, u8 frn, size_t len)
+{
+    BitStream *bs = builder->bs;
+
+    if (frn <= builder->last_frn)
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_ORDER);
+        return eBoolean_FALSE;
+    }
+    if ((frn > (7U * builder->reserved)) && (uap_builder_grow(builder, frn) != eAsterixStatus_OK))
+        return eBoolean_FALSE;
+    if (!bs_require(bs, len))
+        return eBoolean_FALSE;
+
+    builder->present |= UAP_FRN_BIT(frn);
+    builder->last_frn = frn;
+    return eBoolean_TRUE;
+}
+
+/** @brief Announce the next item of a record, before its encoder writes it.
+ *
+ * Items must come in strictly increasing FRN order, as they are laid out in
+ * the record. Fixed-length items are checked against the buffer here, the
+ * others check their own length as in uap_encode_items().
+ *
+ * @param[in/out] builder Builder of the record (must not be NULL)
+ * @param[in] frn FRN of the item
+ * @return eBoolean_TRUE if the item is to be written, eBoolean_FALSE with the
+ * error latched in the BitStream otherwise: eAsterixStatus_ERR_ORDER if frn
+ * does not follow the last item, eAsterixStatus_ERR_FSPEC if the UAP has no
+ * item at frn
+ */
+static inline eBoolean uap_builder_put(UapBuilder *builder, u8 frn)
+{
+    const Uap *uap = builder->uap;
+
+    if (bs_status(builder->bs) != eAsterixStatus_OK)
+        return eBoolean_FALSE;
+    if ((frn > uap->n_frn) || ((uap->valid & UAP_FRN_BIT(frn)) == 0U))
+    {
+        /* Out of order first, as for the items in the UAP */
+        bs_set_error(builder->bs, (frn <= builder->last_frn) ? eAsterixStatus_ERR_ORDER : eAsterixStatus_ERR_FSPEC);
+        return eBoolean_FALSE;
+    }
+    return uap_builder_next(builder, frn,
+                            (uap->items[frn - 1U].kind == eUapItemKind_FIXED) ? uap->items[frn - 1U].len : 0U);
+}
+
+/** @brief Write the FSPEC of the items put and end the record.
+ *
+ * The FSPEC is the shortest holding the items written: exactly the octets
+ * reserved, so the items stay where they are.
+ *
+ * @param[in/out] builder Builder of the record (must not be NULL)
+ * @return eAsterixStatus_OK, or the first error found (see bs_status())
+ */
+ASTERIX_LIB eAsterixStatus uap_builder_end(UapBuilder *builder);
+
+/* ================================ PLANS ================================ */
+
+/** @brief Decode plan of an FSPEC pattern, from the cache of the calling thread.
+ *
+ * The plan is built (and cached) on the first use of the pattern. The
+ * returned pointer is only valid until the next call from the same thread.
+ *
+ * @param[in] uap UAP of the category (must not be NULL)
+ * @param[in] present Presence mask validated against the UAP
+ * @return Plan for the pattern, or NULL if it has more than
+ * UAP_PLAN_MAX_ITEMS items or the cache is disabled (ASTERIX_NO_PLAN_CACHE)
+ */
+ASTERIX_LIB const UapPlan *uap_plan(const Uap *uap, u64 present);
+
+/** @brief Hit/miss statistics of the plan cache of the calling thread.
+ *
+ * @param[out] stats Statistics since the thread started or the last reset
+ */
+ASTERIX_LIB void uap_plan_stats(UapPlanStats *stats);
+
+/**
+ * @brief Drop every cached plan of the calling thread and its statistics
+ */
+ASTERIX_LIB void uap_plan_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UAP_H */
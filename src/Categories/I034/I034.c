@@ -6,127 +6,469 @@
  * 
  * @copyright Copyright (c) 2026
  */
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
 #include <Categories/I034/I034.h>
 
+/* ================================== UAP ================================== */
+
+/* Adapt the typed item codecs to the generic UAP signatures */
+/* Compiled-out items (see I034_config.h) get neither adapters nor codecs:
+ * their FRN is left out of the valid mask, so no record reaches them */
+#define I034_UAP_CODECS(ID)     I034_IF(ID, I034_UAP_ADAPTERS(ID))
+#define I034_UAP_ADAPTERS(ID)                                           \
+    static void uap_encode_I034_##ID(BitStream *bs, const void *item)   \
+    {                                                                   \
+        encode_I034_##ID(bs, (const I034_##ID *)item);                  \
+    }                                                                   \
+    static void uap_decode_I034_##ID(BitStream *bs, void *item)         \
+    {                                                                   \
+        decode_I034_##ID(bs, (I034_##ID *)item);                        \
+    }                                                                   \
+    static size_t uap_size_I034_##ID(const void *item)                  \
+    {                                                                   \
+        return encoded_size_I034_##ID((const I034_##ID *)item);         \
+    }
+
+/* Fixed-length items are also read straight from their octets (see UapReadFn) */
+#define I034_UAP_READER(ID)     I034_IF(ID, I034_UAP_READ_ADAPTER(ID))
+#define I034_UAP_READ_ADAPTER(ID)                                       \
+    static void uap_read_I034_##ID(const u8 *data, void *item)          \
+    {                                                                   \
+        read_I034_##ID(data, (I034_##ID *)item);                        \
+    }
+
+#define I034_UAP_ITEM(ID, KIND, LEN, READ)                              \
+    { "I034/" #ID, (KIND), (LEN), offsetof(I034, I034_##ID),            \
+      I034_SELECT(ID, uap_encode_I034_##ID, NULL),                      \
+      I034_SELECT(ID, uap_decode_I034_##ID, NULL),                      \
+      I034_SELECT(ID, length_I034_##ID, NULL),                          \
+      I034_SELECT(ID, uap_size_I034_##ID, NULL),                        \
+      I034_SELECT(ID, READ, NULL) }
+
+/* Valid mask bit of an item: set only if the item is built */
+#define I034_UAP_VALID(ID)                                              \
+    ((u64)I034_SELECT(ID, 1U, 0U) << (eI034_FRN_I034_##ID - 1U))
+
+I034_UAP_CODECS(010)
+I034_UAP_CODECS(000)
+I034_UAP_CODECS(030)
+I034_UAP_CODECS(020)
+I034_UAP_CODECS(041)
+I034_UAP_CODECS(050)
+I034_UAP_CODECS(060)
+I034_UAP_CODECS(070)
+I034_UAP_CODECS(100)
+I034_UAP_CODECS(110)
+I034_UAP_CODECS(120)
+I034_UAP_CODECS(090)
+I034_UAP_CODECS(RE)
+I034_UAP_CODECS(SP)
+
+I034_UAP_READER(010)
+I034_UAP_READER(000)
+I034_UAP_READER(030)
+I034_UAP_READER(020)
+I034_UAP_READER(041)
+I034_UAP_READER(100)
+I034_UAP_READER(110)
+I034_UAP_READER(120)
+I034_UAP_READER(090)
+
+static const UapItem I034_UAP_ITEMS[I034_FRN_COUNT] = {
+    I034_UAP_ITEM(010, eUapItemKind_FIXED,      I034_010_LEN, uap_read_I034_010),  /* FRN 1 */
+    I034_UAP_ITEM(000, eUapItemKind_FIXED,      I034_000_LEN, uap_read_I034_000),  /* FRN 2 */
+    I034_UAP_ITEM(030, eUapItemKind_FIXED,      I034_030_LEN, uap_read_I034_030),  /* FRN 3 */
+    I034_UAP_ITEM(020, eUapItemKind_FIXED,      I034_020_LEN, uap_read_I034_020),  /* FRN 4 */
+    I034_UAP_ITEM(041, eUapItemKind_FIXED,      I034_041_LEN, uap_read_I034_041),  /* FRN 5 */
+    I034_UAP_ITEM(050, eUapItemKind_COMPOUND,   0U,           NULL),               /* FRN 6 */
+    I034_UAP_ITEM(060, eUapItemKind_COMPOUND,   0U,           NULL),               /* FRN 7 */
+    I034_UAP_ITEM(070, eUapItemKind_REPETITIVE, 0U,           NULL),               /* FRN 8 */
+    I034_UAP_ITEM(100, eUapItemKind_FIXED,      I034_100_LEN, uap_read_I034_100),  /* FRN 9 */
+    I034_UAP_ITEM(110, eUapItemKind_FIXED,      I034_110_LEN, uap_read_I034_110),  /* FRN 10 */
+    I034_UAP_ITEM(120, eUapItemKind_FIXED,      I034_120_LEN, uap_read_I034_120),  /* FRN 11 */
+    I034_UAP_ITEM(090, eUapItemKind_FIXED,      I034_090_LEN, uap_read_I034_090),  /* FRN 12 */
+    I034_UAP_ITEM(RE,  eUapItemKind_EXPLICIT,   0U,           NULL),               /* FRN 13 */
+    I034_UAP_ITEM(SP,  eUapItemKind_EXPLICIT,   0U,           NULL),               /* FRN 14 */
+};
+
+const Uap I034_UAP = {
+    34U,
+    I034_FRN_COUNT,
+    I034_UAP_ITEMS,
+    I034_UAP_VALID(010) | I034_UAP_VALID(000) | I034_UAP_VALID(030) |
+    I034_UAP_VALID(020) | I034_UAP_VALID(041) | I034_UAP_VALID(050) |
+    I034_UAP_VALID(060) | I034_UAP_VALID(070) | I034_UAP_VALID(100) |
+    I034_UAP_VALID(110) | I034_UAP_VALID(120) | I034_UAP_VALID(090) |
+    I034_UAP_VALID(RE)  | I034_UAP_VALID(SP),
+};
+
+#undef I034_UAP_VALID
+
 /* =============================== DE/ENCODE =============================== */
 
-void encode_I034(BitStream *bs, const I034 *item)
+eAsterixStatus encode_I034(BitStream *bs, const I034 *item)
 {
-    // FSPEC
-    bs_serialize_u8(bs, item->FSPEC.I034_010, 1U);
-    bs_serialize_u8(bs, item->FSPEC.I034_000, 1U);
-    bs_serialize_u8(bs, item->FSPEC.I034_030, 1U);
-    bs_serialize_u8(bs, item->FSPEC.I034_020, 1U);
-    bs_serialize_u8(bs, item->FSPEC.I034_041, 1U);
-    bs_serialize_u8(bs, item->FSPEC.I034_050, 1U);
-    bs_serialize_u8(bs, item->FSPEC.I034_060, 1U);
-    bs_serialize_u8(bs, item->FSPEC.FX_1,     1U);
-    if (item->FSPEC.FX_1 == ePresenceFlag_PRESENT)
+    if (uap_encode_fspec(bs, &I034_UAP, item->FSPEC.present) == eAsterixStatus_OK)
+        uap_encode_items(bs, &I034_UAP, item->FSPEC.present, item);
+
+    // HEADER (CAT and LEN)
+    if (bs_status(bs) == eAsterixStatus_OK)
+        bs_serialize_header(bs, I034_UAP.cat);
+
+    return bs_status(bs);
+}
+
+size_t encoded_size_I034(const I034 *item)
+{
+    size_t len = encoded_size_I034_record(item);
+
+    return (len != 0U) ? (ASTERIX_BLOCK_HEADER_LEN + len) : 0U;
+}
+
+size_t encoded_size_I034_record(const I034 *item)
+{
+    return uap_encoded_size(&I034_UAP, item->FSPEC.present, item);
+}
+
+eAsterixStatus index_I034(BitStream *bs, I034_Index *index)
+{
+    index->record_len = 0U;
+
+    // HEADER (CAT and LEN), validated once for the whole data block
+    if (bs_validate_block(bs) == eAsterixStatus_OK)
     {
-        bs_serialize_u8(bs, item->FSPEC.I034_070, 1U);
-        bs_serialize_u8(bs, item->FSPEC.I034_100, 1U);
-        bs_serialize_u8(bs, item->FSPEC.I034_110, 1U);
-        bs_serialize_u8(bs, item->FSPEC.I034_120, 1U);
-        bs_serialize_u8(bs, item->FSPEC.I034_090, 1U);
-        bs_serialize_u8(bs, item->FSPEC.I034_RE,  1U);
-        bs_serialize_u8(bs, item->FSPEC.I034_SP,  1U);
-        bs_serialize_u8(bs, item->FSPEC.FX_2,     1U);
+        index->HEADER.CAT = bs_deserialize_cat(bs);
+        index->HEADER.LEN = bs_deserialize_len(bs);
     }
 
-    if (item->FSPEC.I034_010 == ePresenceFlag_PRESENT)
-        encode_I034_010(bs, &item->I034_010);
-    if (item->FSPEC.I034_000 == ePresenceFlag_PRESENT)
-        encode_I034_000(bs, &item->I034_000);
-    if (item->FSPEC.I034_030 == ePresenceFlag_PRESENT)
-        encode_I034_030(bs, &item->I034_030);
-    if (item->FSPEC.I034_020 == ePresenceFlag_PRESENT)
-        encode_I034_020(bs, &item->I034_020);
-    if (item->FSPEC.I034_041 == ePresenceFlag_PRESENT)
-        encode_I034_041(bs, &item->I034_041);
-    if (item->FSPEC.I034_050 == ePresenceFlag_PRESENT)
-        encode_I034_050(bs, &item->I034_050);
-    if (item->FSPEC.I034_060 == ePresenceFlag_PRESENT)
-        encode_I034_060(bs, &item->I034_060);
-    if (item->FSPEC.FX_1 == ePresenceFlag_PRESENT)
+    // FSPEC
+    if (uap_decode_fspec(bs, &I034_UAP, &index->FSPEC.present) != eAsterixStatus_OK)
     {
-        if (item->FSPEC.I034_070 == ePresenceFlag_PRESENT)
-            encode_I034_070(bs, &item->I034_070);
-        if (item->FSPEC.I034_100 == ePresenceFlag_PRESENT)
-            encode_I034_100(bs, &item->I034_100);
-        if (item->FSPEC.I034_110 == ePresenceFlag_PRESENT)
-            encode_I034_110(bs, &item->I034_110);
-        if (item->FSPEC.I034_120 == ePresenceFlag_PRESENT)
-            encode_I034_120(bs, &item->I034_120);
-        if (item->FSPEC.I034_090 == ePresenceFlag_PRESENT)
-            encode_I034_090(bs, &item->I034_090);
-        if (item->FSPEC.I034_RE == ePresenceFlag_PRESENT)
-            encode_I034_RE(bs, &item->I034_RE);
-        if (item->FSPEC.I034_SP == ePresenceFlag_PRESENT)
-            encode_I034_SP(bs, &item->I034_SP);
+        memset(index->ITEM, 0, sizeof(index->ITEM));
+        return bs_status(bs);
     }
 
-    // HEADER (CAT and LEN)
-    bs_serialize_header(bs, 34U);
+    // ITEMS
+    uap_index_items(bs, &I034_UAP, index->FSPEC.present, index->ITEM);
+    index->record_len = (u16)bs->byte_pos;
+    return bs_status(bs);
+}
+
+eAsterixStatus decode_I034(BitStream *bs, I034 *item)
+{
+    // HEADER (CAT and LEN), validated once for the whole data block
+    if (bs_validate_block(bs) != eAsterixStatus_OK)
+        return bs_status(bs);
+
+    return decode_I034_record(bs, item);
 }
 
-void decode_I034(BitStream *bs, I034 *item)
+eAsterixStatus decode_I034_masked(BitStream *bs, I034 *item, u64 mask)
 {
+    // HEADER (CAT and LEN), validated once for the whole data block
+    if (bs_validate_block(bs) != eAsterixStatus_OK)
+        return bs_status(bs);
+
+    return decode_I034_record_masked(bs, item, mask);
+}
+
+eAsterixStatus decode_I034_record(BitStream *bs, I034 *item)
+{
+    return decode_I034_record_masked(bs, item, I034_MASK_ALL);
+}
+
+eAsterixStatus decode_I034_record_masked(BitStream *bs, I034 *item, u64 mask)
+{
+    u64 present = 0U;
+
+    item->HEADER.CAT = bs_deserialize_cat(bs);
+    item->HEADER.LEN = bs_deserialize_len(bs);
+
     // FSPEC
-    item->FSPEC.I034_010 = bs_deserialize_u8(bs, 1U);
-    item->FSPEC.I034_000 = bs_deserialize_u8(bs, 1U);
-    item->FSPEC.I034_030 = bs_deserialize_u8(bs, 1U);
-    item->FSPEC.I034_020 = bs_deserialize_u8(bs, 1U);
-    item->FSPEC.I034_041 = bs_deserialize_u8(bs, 1U);
-    item->FSPEC.I034_050 = bs_deserialize_u8(bs, 1U);
-    item->FSPEC.I034_060 = bs_deserialize_u8(bs, 1U);
-    item->FSPEC.FX_1     = bs_deserialize_u8(bs, 1U);
-    if (item->FSPEC.FX_1 == ePresenceFlag_PRESENT)
+    item->FSPEC.present = 0U;
+    if (uap_decode_fspec(bs, &I034_UAP, &present) != eAsterixStatus_OK)
+        return bs_status(bs);
+
+    // ITEMS, the ones outside the mask skipped and reported absent
+    item->FSPEC.present = present & mask;
+    return uap_decode_selected(bs, &I034_UAP, present, mask, item);
+}
+
+size_t decode_I034_batch(BitStream *bs, I034 *items, size_t n_items)
+{
+    return decode_I034_batch_masked(bs, items, n_items, I034_MASK_ALL);
+}
+
+size_t decode_I034_batch_masked(BitStream *bs, I034 *items, size_t n_items, u64 mask)
+{
+    size_t n = 0U;
+
+    // HEADER (CAT and LEN), validated once per call for the whole data block
+    if (bs_validate_block(bs) != eAsterixStatus_OK)
+        return 0U;
+
+    // RECORDS, back to back up to LEN
+    while ((n < n_items) && (bs->byte_pos < bs->limit))
     {
-        item->FSPEC.I034_070 = bs_deserialize_u8(bs, 1U);
-        item->FSPEC.I034_100 = bs_deserialize_u8(bs, 1U);
-        item->FSPEC.I034_110 = bs_deserialize_u8(bs, 1U);
-        item->FSPEC.I034_120 = bs_deserialize_u8(bs, 1U);
-        item->FSPEC.I034_090 = bs_deserialize_u8(bs, 1U);
-        item->FSPEC.I034_RE  = bs_deserialize_u8(bs, 1U);
-        item->FSPEC.I034_SP  = bs_deserialize_u8(bs, 1U);
-        item->FSPEC.FX_2     = bs_deserialize_u8(bs, 1U);        
+        if (decode_I034_record_masked(bs, &items[n], mask) != eAsterixStatus_OK)
+            break;
+        n++;
     }
+    return n;
+}
+
+eAsterixStatus skip_I034_record(BitStream *bs)
+{
+    u64 present = 0U;
+
+    // FSPEC, then every present item measured from its raw octets
+    if (uap_decode_fspec(bs, &I034_UAP, &present) != eAsterixStatus_OK)
+        return bs_status(bs);
+    return uap_skip_items(bs, &I034_UAP, present);
+}
+
+/* ================================ VISITOR ================================ */
+
+/* Decode the item into a temporary scoped to its case, or skip it, unless
+ * its length can not be read or does not fit in the block */
+#define I034_VISIT(ID)      I034_IF(ID, I034_VISIT_CASE(ID))
+#define I034_VISIT_CASE(ID)                                                 \
+    case eI034_FRN_I034_##ID:                                               \
+    {                                                                       \
+        size_t len = length_I034_##ID(bs);                                  \
+        if ((len == 0U) || !bs_require(bs, len))                            \
+            break;                                                          \
+        if (visitor->on_I034_##ID == NULL)                                  \
+        {                                                                   \
+            bs->byte_pos += len;                                            \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            I034_##ID tmp;                                                  \
+            decode_I034_##ID(bs, &tmp);                                     \
+            if (bs_status(bs) == eAsterixStatus_OK)                         \
+                visitor->on_I034_##ID(visitor->ctx, &tmp);                  \
+        }                                                                   \
+        break;                                                              \
+    }
+
+eAsterixStatus visit_I034(BitStream *bs, const I034_Visitor *visitor)
+{
+    u64 present = 0U;
+
+    // HEADER (CAT and LEN), validated once for the whole data block
+    if (bs_validate_block(bs) != eAsterixStatus_OK)
+        return bs_status(bs);
+
+    // FSPEC
+    if (uap_decode_fspec(bs, &I034_UAP, &present) != eAsterixStatus_OK)
+        return bs_status(bs);
 
     // ITEMS
-    if (item->FSPEC.I034_010 == ePresenceFlag_PRESENT)
-        encode_I034_010(bs, &item->I034_010);
-    if (item->FSPEC.I034_000 == ePresenceFlag_PRESENT)
-        encode_I034_000(bs, &item->I034_000);
-    if (item->FSPEC.I034_030 == ePresenceFlag_PRESENT)
-        encode_I034_030(bs, &item->I034_030);
-    if (item->FSPEC.I034_020 == ePresenceFlag_PRESENT)
-        encode_I034_020(bs, &item->I034_020);
-    if (item->FSPEC.I034_041 == ePresenceFlag_PRESENT)
-        encode_I034_041(bs, &item->I034_041);
-    if (item->FSPEC.I034_050 == ePresenceFlag_PRESENT)
-        encode_I034_050(bs, &item->I034_050);
-    if (item->FSPEC.I034_060 == ePresenceFlag_PRESENT)
-        encode_I034_060(bs, &item->I034_060);
-    if (item->FSPEC.FX_1 == ePresenceFlag_PRESENT)
+    return visit_I034_items(bs, visitor, present);
+}
+
+eAsterixStatus visit_I034_items(BitStream *bs, const I034_Visitor *visitor, u64 present)
+{
+    while ((present != 0U) && (bs_status(bs) == eAsterixStatus_OK))
     {
-        if (item->FSPEC.I034_070 == ePresenceFlag_PRESENT)
-            encode_I034_070(bs, &item->I034_070);
-        if (item->FSPEC.I034_100 == ePresenceFlag_PRESENT)
-            encode_I034_100(bs, &item->I034_100);
-        if (item->FSPEC.I034_110 == ePresenceFlag_PRESENT)
-            encode_I034_110(bs, &item->I034_110);
-        if (item->FSPEC.I034_120 == ePresenceFlag_PRESENT)
-            encode_I034_120(bs, &item->I034_120);
-        if (item->FSPEC.I034_090 == ePresenceFlag_PRESENT)
-            encode_I034_090(bs, &item->I034_090);
-        if (item->FSPEC.I034_RE == ePresenceFlag_PRESENT)
-            encode_I034_RE(bs, &item->I034_RE);
-        if (item->FSPEC.I034_SP == ePresenceFlag_PRESENT)
-            encode_I034_SP(bs, &item->I034_SP);
+        size_t frn = uap_ctz64(present) + 1U;
+
+        present &= present - 1U;
+        switch (frn)
+        {
+            I034_VISIT(010)
+            I034_VISIT(000)
+            I034_VISIT(030)
+            I034_VISIT(020)
+            I034_VISIT(041)
+            I034_VISIT(050)
+            I034_VISIT(060)
+            I034_VISIT(070)
+            I034_VISIT(100)
+            I034_VISIT(110)
+            I034_VISIT(120)
+            I034_VISIT(090)
+            I034_VISIT(RE)
+            I034_VISIT(SP)
+            default:
+                break;
+        }
     }
+    return bs_status(bs);
+}
 
-    // HEADER (CAT and LEN)
-    bs_serialize_header(bs, 34U);
+#undef I034_VISIT
+#undef I034_VISIT_CASE
+
+/* ================================= VIEW ================================= */
+
+eAsterixStatus view_I034(I034_View *view, const u8 *data, size_t size)
+{
+    BitStream bs;
+
+    /* The stream is only read: the octets are never written through it */
+    bs_init(&bs, (u8 *)data, size);
+    view->data = data;
+    return index_I034(&bs, &view->index);
+}
+
+/* Decode the item of the given FRN from the raw octets, if present */
+static eBoolean view_I034_item(const I034_View *view, size_t frn, void *item)
+{
+    const UapItemRef *ref = &view->index.ITEM[frn - 1U];
+    BitStream bs;
+
+    if (ref->frn == 0U)
+        return eBoolean_FALSE;
+
+    bs_init(&bs, (u8 *)view->data, view->index.record_len);
+    bs.byte_pos = ref->offset;
+    I034_UAP.items[frn - 1U].decode(&bs, item);
+    return eBoolean_TRUE;
+}
+
+#define I034_VIEW_ACCESSOR(ID)  I034_IF(ID, I034_VIEW_ACCESSOR_(ID))
+#define I034_VIEW_ACCESSOR_(ID)                                             \
+    eBoolean view_I034_##ID(const I034_View *view, I034_##ID *item)         \
+    {                                                                       \
+        return view_I034_item(view, eI034_FRN_I034_##ID, item);             \
+    }
+
+I034_VIEW_ACCESSOR(010)
+I034_VIEW_ACCESSOR(000)
+I034_VIEW_ACCESSOR(030)
+I034_VIEW_ACCESSOR(020)
+I034_VIEW_ACCESSOR(041)
+I034_VIEW_ACCESSOR(050)
+I034_VIEW_ACCESSOR(060)
+I034_VIEW_ACCESSOR(070)
+I034_VIEW_ACCESSOR(100)
+I034_VIEW_ACCESSOR(110)
+I034_VIEW_ACCESSOR(120)
+I034_VIEW_ACCESSOR(090)
+I034_VIEW_ACCESSOR(RE)
+I034_VIEW_ACCESSOR(SP)
+
+#undef I034_VIEW_ACCESSOR
+#undef I034_VIEW_ACCESSOR_
+
+/* ================================= FIELDS ================================= */
+
+/* Field metadata by FRN: none for the explicit-length fields, whose layout
+ * the category does not define, nor for the compiled-out items */
+#define I034_FIELD_ITEM(ID)     I034_SELECT(ID, &I034_##ID##_FIELDS, NULL)
+
+const FieldItem *const I034_FIELDS[I034_FRN_COUNT] = {
+    I034_FIELD_ITEM(010),   /* FRN 1 */
+    I034_FIELD_ITEM(000),   /* FRN 2 */
+    I034_FIELD_ITEM(030),   /* FRN 3 */
+    I034_FIELD_ITEM(020),   /* FRN 4 */
+    I034_FIELD_ITEM(041),   /* FRN 5 */
+    I034_FIELD_ITEM(050),   /* FRN 6 */
+    I034_FIELD_ITEM(060),   /* FRN 7 */
+    I034_FIELD_ITEM(070),   /* FRN 8 */
+    I034_FIELD_ITEM(100),   /* FRN 9 */
+    I034_FIELD_ITEM(110),   /* FRN 10 */
+    I034_FIELD_ITEM(120),   /* FRN 11 */
+    I034_FIELD_ITEM(090),   /* FRN 12 */
+    NULL,                   /* FRN 13: I034/RE */
+    NULL,                   /* FRN 14: I034/SP */
+};
+
+#undef I034_FIELD_ITEM
+
+eAsterixStatus compile_I034_field(FieldAccessor *acc, const char *path)
+{
+    return field_compile(acc, I034_FIELDS, I034_FRN_COUNT, path);
 }
 
 /* ============================== EXTRA FUNCS ============================== */
+
+#if I034_WITH_PRINT
+
+#define I034_PRINT(ID)      I034_IF(ID, I034_PRINT_ITEM(ID))
+#define I034_PRINT_ITEM(ID)                                                 \
+    if (I034_FSPEC_GET(&item->FSPEC, I034_##ID))                            \
+        print_I034_##ID(&item->I034_##ID);
+
+void print_I034(const I034 *item)
+{
+    printf("I034 - Transmission of Monoradar Service Messages\n");
+    if (!item)
+    {
+        printf("I034: <null>\n");
+        return;
+    }
+
+    printf("- CAT = %u\n", item->HEADER.CAT);
+    printf("- LEN = %u\n", item->HEADER.LEN);
+    I034_PRINT(010)
+    I034_PRINT(000)
+    I034_PRINT(030)
+    I034_PRINT(020)
+    I034_PRINT(041)
+    I034_PRINT(050)
+    I034_PRINT(060)
+    I034_PRINT(070)
+    I034_PRINT(100)
+    I034_PRINT(110)
+    I034_PRINT(120)
+    I034_PRINT(090)
+    I034_PRINT(RE)
+    I034_PRINT(SP)
+}
+
+#undef I034_PRINT
+#undef I034_PRINT_ITEM
+
+#endif /* I034_WITH_PRINT */
+
+/* =============================== REGISTRY =============================== */
+
+/* Adapt the typed codecs to the generic AsterixCategory signatures */
+static size_t registry_decode_I034(BitStream *bs, void *records, size_t n_records)
+{
+    return decode_I034_batch(bs, (I034 *)records, n_records);
+}
+
+static size_t registry_decode_masked_I034(BitStream *bs, void *records, size_t n_records, u64 mask)
+{
+    return decode_I034_batch_masked(bs, (I034 *)records, n_records, mask);
+}
+
+static eAsterixStatus registry_encode_I034(BitStream *bs, const void *record)
+{
+    return encode_I034(bs, (const I034 *)record);
+}
+
+static eAsterixStatus registry_view_I034(void *view, const u8 *data, size_t size)
+{
+    return view_I034((I034_View *)view, data, size);
+}
+
+#if I034_WITH_PRINT
+static void registry_print_I034(const void *record)
+{
+    print_I034((const I034 *)record);
+}
+#else
+    #define registry_print_I034     NULL
+#endif
+
+const AsterixCategory I034_CATEGORY = {
+    34U,
+    "I034",
+    &I034_UAP,
+    sizeof(I034),
+    sizeof(I034_View),
+    registry_decode_I034,
+    registry_decode_masked_I034,
+    registry_encode_I034,
+    skip_I034_record,
+    registry_view_I034,
+    registry_print_I034,
+};
@@ -9,21 +9,78 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_000.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_000
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_000(BitStream *bs, const I034_000 *item)
 {
-    bs_serialize_u32(bs, item->MSGTYPE, 8U);
+    bs_serialize_aligned_u8(bs, (u8)item->MSGTYPE);
 }
 
 void decode_I034_000(BitStream *bs, I034_000 *item)
 {
-    item->MSGTYPE = bs_deserialize_u32(bs, 8U);
+    u8 tmp[I034_000_LEN];
+    read_I034_000(bs_read_ptr(bs, tmp, I034_000_LEN), item);
+}
+
+void read_I034_000(const u8 *raw, I034_000 *item)
+{
+    item->MSGTYPE = (eI034_000_MSG_TYPE)raw[0U];
+}
+
+size_t length_I034_000(BitStream *bs)
+{
+    (void)bs;
+    return I034_000_LEN;
+}
+
+size_t encoded_size_I034_000(const I034_000 *item)
+{
+    (void)item;
+    return I034_000_LEN;
+}
+
+void skip_I034_000(BitStream *bs)
+{
+    bs_skip(bs, I034_000_LEN);
 }
 
+/* ================================ METADATA =============================== */
+
+#define I034_000_LABEL(NAME)    { (u32)eI034_000_MSG_TYPE_##NAME, #NAME }
+
+static const FieldLabel I034_000_MSGTYPE_LABELS[] =
+{
+    I034_000_LABEL(NORTH_MARKER),
+    I034_000_LABEL(SECTOR_CROSSING),
+    I034_000_LABEL(GEO_FILTERING),
+    I034_000_LABEL(JAMMING_STROBE),
+    I034_000_LABEL(SOLAR_STORM),
+    I034_000_LABEL(SSR_JAMMING_STROBE),
+    I034_000_LABEL(MS_JAMMING_STROBE),
+};
+
+static const FieldMeta I034_000_FIELD_META[] =
+{
+    FIELD_ENUM("MSGTYPE", 0U, 8U, I034_000_MSGTYPE_LABELS),
+};
+
+static const FieldGroup I034_000_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_000_FIELD_META),
+};
+
+const FieldItem I034_000_FIELDS =
+{
+    "I034/000", (u8)eUapItemKind_FIXED, 0U, NULL, I034_000_FIELD_GROUPS, FIELD_COUNT(I034_000_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_000(const I034_000 *item)
 {
     printf("I034/000 - Message Type\n");
@@ -33,4 +90,7 @@ void print_I034_000(const I034_000 *item)
         return;
     }
     printf("- MSGTYPE = %u\n", item->MSGTYPE);
-}
\ No newline at end of file
+}
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_000 */
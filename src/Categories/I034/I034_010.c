@@ -9,6 +9,9 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_010.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_010
 
 /* =============================== DE/ENCODE =============================== */
 
@@ -19,11 +22,53 @@ void encode_I034_010(BitStream *bs, const I034_010 *item)
 
 void decode_I034_010(BitStream *bs, I034_010 *item)
 {
-    decode_SAC_SIC(bs, item);
+    u8 tmp[I034_010_LEN];
+    read_I034_010(bs_read_ptr(bs, tmp, I034_010_LEN), item);
+}
+
+void read_I034_010(const u8 *raw, I034_010 *item)
+{
+    read_SAC_SIC(raw, item);
 }
 
+size_t length_I034_010(BitStream *bs)
+{
+    (void)bs;
+    return I034_010_LEN;
+}
+
+size_t encoded_size_I034_010(const I034_010 *item)
+{
+    (void)item;
+    return I034_010_LEN;
+}
+
+void skip_I034_010(BitStream *bs)
+{
+    bs_skip(bs, I034_010_LEN);
+}
+
+/* ================================ METADATA =============================== */
+
+static const FieldMeta I034_010_FIELD_META[] =
+{
+    FIELD_UNSIGNED("SAC", 0U, 8U, 1, 1U, NULL),
+    FIELD_UNSIGNED("SIC", 8U, 8U, 1, 1U, NULL),
+};
+
+static const FieldGroup I034_010_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_010_FIELD_META),
+};
+
+const FieldItem I034_010_FIELDS =
+{
+    "I034/010", (u8)eUapItemKind_FIXED, 0U, NULL, I034_010_FIELD_GROUPS, FIELD_COUNT(I034_010_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_010(const I034_010 *item)
 {
     printf("I034/010 - Data Source Identification\n");
@@ -34,3 +79,6 @@ void print_I034_010(const I034_010 *item)
     }
     printf("- SAC = 0x%02X / SIC = 0x%02X\n", item->SAC, item->SIC);
 }
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_010 */
@@ -9,21 +9,65 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_020.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_020
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_020(BitStream *bs, const I034_020 *item)
 {
-    bs_serialize_ufloat(bs, item->SECTAZ, I034_020_LSB_SECTNUM, 8U);
+    bs_serialize_aligned_u8(bs, get_I034_020_SECTAZ_raw(item));
 }
 
 void decode_I034_020(BitStream *bs, I034_020 *item)
 {
-    item->SECTAZ = bs_deserialize_ufloat(bs, I034_020_LSB_SECTNUM, 8U);
+    u8 tmp[I034_020_LEN];
+    read_I034_020(bs_read_ptr(bs, tmp, I034_020_LEN), item);
+}
+
+void read_I034_020(const u8 *raw, I034_020 *item)
+{
+    set_I034_020_SECTAZ_raw(item, raw[0U]);
 }
 
+size_t length_I034_020(BitStream *bs)
+{
+    (void)bs;
+    return I034_020_LEN;
+}
+
+size_t encoded_size_I034_020(const I034_020 *item)
+{
+    (void)item;
+    return I034_020_LEN;
+}
+
+void skip_I034_020(BitStream *bs)
+{
+    bs_skip(bs, I034_020_LEN);
+}
+
+/* ================================ METADATA =============================== */
+
+static const FieldMeta I034_020_FIELD_META[] =
+{
+    FIELD_UNSIGNED("SECTAZ", 0U, 8U, 45, 32U, "deg"),   /* 360/2^8 */
+};
+
+static const FieldGroup I034_020_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_020_FIELD_META),
+};
+
+const FieldItem I034_020_FIELDS =
+{
+    "I034/020", (u8)eUapItemKind_FIXED, 0U, NULL, I034_020_FIELD_GROUPS, FIELD_COUNT(I034_020_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_020(const I034_020 *item)
 {
     printf("I034/020 - Sector Number\n");
@@ -32,5 +76,12 @@ void print_I034_020(const I034_020 *item)
         printf("I034/020: <null>\n");
         return;
     }
-    printf("- SECTORNUM = %.4f deg\n", item->SECTAZ);
+#ifdef ASTERIX_NO_FLOAT
+    printf("- SECTORNUM = %u x 360/2^8 deg\n", (unsigned)get_I034_020_SECTAZ_raw(item));
+#else
+    printf("- SECTORNUM = %.4f deg\n", get_I034_020_SECTAZ(item));
+#endif
 }
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_020 */
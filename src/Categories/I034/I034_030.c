@@ -9,21 +9,65 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_030.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_030
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_030(BitStream *bs, const I034_030 *item)
 {
-    bs_serialize_ufloat(bs, item->TOD, I034_030_LSB_TOD, 24U);
+    bs_serialize_aligned_u24(bs, get_I034_030_TOD_raw(item));
 }
 
 void decode_I034_030(BitStream *bs, I034_030 *item)
 {
-    item->TOD = bs_deserialize_ufloat(bs, I034_030_LSB_TOD, 24U);
+    u8 tmp[I034_030_LEN];
+    read_I034_030(bs_read_ptr(bs, tmp, I034_030_LEN), item);
+}
+
+void read_I034_030(const u8 *raw, I034_030 *item)
+{
+    set_I034_030_TOD_raw(item, bs_load_u24(raw));
 }
 
+size_t length_I034_030(BitStream *bs)
+{
+    (void)bs;
+    return I034_030_LEN;
+}
+
+size_t encoded_size_I034_030(const I034_030 *item)
+{
+    (void)item;
+    return I034_030_LEN;
+}
+
+void skip_I034_030(BitStream *bs)
+{
+    bs_skip(bs, I034_030_LEN);
+}
+
+/* ================================ METADATA =============================== */
+
+static const FieldMeta I034_030_FIELD_META[] =
+{
+    FIELD_UNSIGNED("TOD", 0U, 24U, 1, 128U, "s"),
+};
+
+static const FieldGroup I034_030_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_030_FIELD_META),
+};
+
+const FieldItem I034_030_FIELDS =
+{
+    "I034/030", (u8)eUapItemKind_FIXED, 0U, NULL, I034_030_FIELD_GROUPS, FIELD_COUNT(I034_030_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_030(const I034_030 *item)
 {
     printf("I034/030 - Time of Day (TOD)\n");
@@ -32,5 +76,12 @@ void print_I034_030(const I034_030 *item)
         printf("I034/030: <null>\n");
         return;
     }
-    printf("- TOD = %f\n", item->TOD);
+#ifdef ASTERIX_NO_FLOAT
+    printf("- TOD = %lu x 1/128 s\n", (unsigned long)get_I034_030_TOD_raw(item));
+#else
+    printf("- TOD = %f\n", get_I034_030_TOD(item));
+#endif
 }
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_030 */
@@ -9,21 +9,65 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_041.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_041
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_041(BitStream *bs, const I034_041 *item)
 {
-    bs_serialize_ufloat(bs, item->ANTROTSPD, I034_042_LSB_ANTROTSPD, 16U);
+    bs_serialize_aligned_u16(bs, get_I034_041_ANTROTSPD_raw(item));
 }
 
 void decode_I034_041(BitStream *bs, I034_041 *item)
 {
-    item->ANTROTSPD = bs_deserialize_ufloat(bs, I034_042_LSB_ANTROTSPD, 16U);
+    u8 tmp[I034_041_LEN];
+    read_I034_041(bs_read_ptr(bs, tmp, I034_041_LEN), item);
+}
+
+void read_I034_041(const u8 *raw, I034_041 *item)
+{
+    set_I034_041_ANTROTSPD_raw(item, bs_load_u16(raw));
 }
 
+size_t length_I034_041(BitStream *bs)
+{
+    (void)bs;
+    return I034_041_LEN;
+}
+
+size_t encoded_size_I034_041(const I034_041 *item)
+{
+    (void)item;
+    return I034_041_LEN;
+}
+
+void skip_I034_041(BitStream *bs)
+{
+    bs_skip(bs, I034_041_LEN);
+}
+
+/* ================================ METADATA =============================== */
+
+static const FieldMeta I034_041_FIELD_META[] =
+{
+    FIELD_UNSIGNED("ANTROTSPD", 0U, 16U, 1, 128U, "s"),
+};
+
+static const FieldGroup I034_041_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_041_FIELD_META),
+};
+
+const FieldItem I034_041_FIELDS =
+{
+    "I034/041", (u8)eUapItemKind_FIXED, 0U, NULL, I034_041_FIELD_GROUPS, FIELD_COUNT(I034_041_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_041(const I034_041 *item)
 {
     printf("I034/041 - Antenna Rotation Speed\n");
@@ -32,5 +76,12 @@ void print_I034_041(const I034_041 *item)
         printf("I034/041: <null>\n");
         return;
     }
-    printf("- ANTROTSPD = %f\n", item->ANTROTSPD);
+#ifdef ASTERIX_NO_FLOAT
+    printf("- ANTROTSPD = %u x 1/128 s\n", (unsigned)get_I034_041_ANTROTSPD_raw(item));
+#else
+    printf("- ANTROTSPD = %f\n", get_I034_041_ANTROTSPD(item));
+#endif
 }
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_041 */
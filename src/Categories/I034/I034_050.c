@@ -6,133 +6,197 @@
  * 
  * @copyright Copyright (c) 2026
  */
+#include <stddef.h>
 #include <stdio.h>
 
 #include <Categories/I034/I034_050.h>
+#include <Categories/I034/I034_config.h>
+#include <Infra/compound.h>
+
+#if I034_WITH_050
 
 /* =============================== DE/ENCODE =============================== */
 
+/* Subfield #1: Common Part */
+static void encode_ext1(u8 *raw, const void *sub)
+{
+    const I034_050_EXT1 *ext = (const I034_050_EXT1 *)sub;
 
-void encode_I034_050(BitStream *bs, const I034_050 *item)
+    raw[0] = (u8)(((ext->NOGO & 1U) << 7U) | ((ext->RDPC & 1U) << 6U) | ((ext->RDPR & 1U) << 5U)
+                | ((ext->OVLRDP & 1U) << 4U) | ((ext->OVLXMT & 1U) << 3U) | ((ext->MSC & 1U) << 2U)
+                | ((ext->TSV & 1U) << 1U)); /* Spare 1 bit */
+}
+
+static void decode_ext1(const u8 *raw, void *sub)
 {
-    /* First octet */
-    bs_serialize_u32(bs, item->COM, 1U);
-    bs_inc_pos(bs, 0U, 2U); /* Spare 2 bits */
-    bs_serialize_u32(bs, item->PSR, 1U);
-    bs_serialize_u32(bs, item->SSR, 1U);
-    bs_serialize_u32(bs, item->MDS, 1U);
-    bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    bs_serialize_u32(bs, item->FX, 1U);
-
-    /* Subfield #1: Common Part */
-    if(item->COM == ePresenceFlag_PRESENT)
-    {
-        bs_serialize_u32(bs, item->ext1.NOGO, 1U);
-        bs_serialize_u32(bs, item->ext1.RDPC, 1U);
-        bs_serialize_u32(bs, item->ext1.RDPR, 1U);
-        bs_serialize_u32(bs, item->ext1.OVLRDP, 1U);
-        bs_serialize_u32(bs, item->ext1.OVLXMT, 1U);
-        bs_serialize_u32(bs, item->ext1.MSC, 1U);
-        bs_serialize_u32(bs, item->ext1.TSV, 1U);
-        bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    }
+    I034_050_EXT1 *ext = (I034_050_EXT1 *)sub;
+
+    ext->NOGO = (eI034_050_EXT1_NOGO)((raw[0] >> 7U) & 1U);
+    ext->RDPC = (eI034_050_EXT1_RDPC)((raw[0] >> 6U) & 1U);
+    ext->RDPR = (eI034_050_EXT1_RDPR)((raw[0] >> 5U) & 1U);
+    ext->OVLRDP = (eI034_050_EXT1_OVLRDP)((raw[0] >> 4U) & 1U);
+    ext->OVLXMT = (eI034_050_EXT1_OVLXMT)((raw[0] >> 3U) & 1U);
+    ext->MSC = (eI034_050_EXT1_MSC)((raw[0] >> 2U) & 1U);
+    ext->TSV = (eI034_050_EXT1_TSV)((raw[0] >> 1U) & 1U);
+}
 
-    /* Subfield #4: Specific Status for PSR Sensor */
-    if(item->PSR == ePresenceFlag_PRESENT)
-    {
-        bs_serialize_u32(bs, item->ext4.ANT, 1U);
-        bs_serialize_u32(bs, item->ext4.CHAB, 2U);
-        bs_serialize_u32(bs, item->ext4.OVL, 1U);
-        bs_serialize_u32(bs, item->ext4.MSC, 1U);
-        bs_inc_pos(bs, 0U, 3); /* Spare 1 bit */
-    }
+/* Subfields #4 and #5: Specific Status for PSR and SSR Sensors */
+static void encode_ext45(u8 *raw, const void *sub)
+{
+    const I034_050_EXT45 *ext = (const I034_050_EXT45 *)sub;
 
-    /* Subfield #5: Specific Status for SSR Sensor */
-    if(item->SSR == ePresenceFlag_PRESENT)
-    {
-        bs_serialize_u32(bs, item->ext5.ANT, 1U);
-        bs_serialize_u32(bs, item->ext5.CHAB, 2U);
-        bs_serialize_u32(bs, item->ext5.OVL, 1U);
-        bs_serialize_u32(bs, item->ext5.MSC, 1U);
-        bs_inc_pos(bs, 0U, 3); /* Spare 3 bits */
-    }
+    raw[0] = (u8)(((ext->ANT & 1U) << 7U) | ((ext->CHAB & 3U) << 5U) | ((ext->OVL & 1U) << 4U)
+                | ((ext->MSC & 1U) << 3U)); /* Spare 3 bits */
+}
 
-    /* Subfield #6: Specific Status for Mode S Sensor */
-    if(item->MDS == ePresenceFlag_PRESENT)
-    {
-        bs_serialize_u32(bs, item->ext6.ANT, 1U);
-        bs_serialize_u32(bs, item->ext6.CHAB, 1U);
-        bs_serialize_u32(bs, item->ext6.OVLSUR, 1U);
-        bs_serialize_u32(bs, item->ext6.MSC, 1U);
-        bs_serialize_u32(bs, item->ext6.SCF, 1U);
-        bs_serialize_u32(bs, item->ext6.DLF, 1U);
-        bs_serialize_u32(bs, item->ext6.OVLSCF, 1U);
-        bs_serialize_u32(bs, item->ext6.OVLDLF, 1U);
-        bs_inc_pos(bs, 0U, 7); /* Spare 7 bit */
-    }
+static void decode_ext45(const u8 *raw, void *sub)
+{
+    I034_050_EXT45 *ext = (I034_050_EXT45 *)sub;
+
+    ext->ANT = (eI034_050_EXT45_ANT)((raw[0] >> 7U) & 1U);
+    ext->CHAB = (eI034_050_EXT45_CHAB)((raw[0] >> 5U) & 3U);
+    ext->OVL = (eI034_050_EXT45_OVL)((raw[0] >> 4U) & 1U);
+    ext->MSC = (eI034_050_EXT45_MSC)((raw[0] >> 3U) & 1U);
+}
+
+/* Subfield #6: Specific Status for Mode S Sensor */
+static void encode_ext6(u8 *raw, const void *sub)
+{
+    const I034_050_EXT6 *ext = (const I034_050_EXT6 *)sub;
+
+    raw[0] = (u8)(((ext->ANT & 1U) << 7U) | ((ext->CHAB & 3U) << 5U) | ((ext->OVLSUR & 1U) << 4U)
+                | ((ext->MSC & 1U) << 3U) | ((ext->SCF & 1U) << 2U) | ((ext->DLF & 1U) << 1U)
+                | (ext->OVLSCF & 1U));
+    raw[1] = (u8)((ext->OVLDLF & 1U) << 7U); /* Spare 7 bits */
+}
+
+static void decode_ext6(const u8 *raw, void *sub)
+{
+    I034_050_EXT6 *ext = (I034_050_EXT6 *)sub;
+
+    ext->ANT = (eI034_050_EXT6_ANT)((raw[0] >> 7U) & 1U);
+    ext->CHAB = (eI034_050_EXT6_CHAB)((raw[0] >> 5U) & 3U);
+    ext->OVLSUR = (eI034_050_EXT6_OVLSUR)((raw[0] >> 4U) & 1U);
+    ext->MSC = (eI034_050_EXT6_MSC)((raw[0] >> 3U) & 1U);
+    ext->SCF = (eI034_050_EXT6_SCF)((raw[0] >> 2U) & 1U);
+    ext->DLF = (eI034_050_EXT6_DLF)((raw[0] >> 1U) & 1U);
+    ext->OVLSCF = (eI034_050_EXT6_OVLSCF)(raw[0] & 1U);
+    ext->OVLDLF = (eI034_050_EXT6_OVLDLF)((raw[1] >> 7U) & 1U);
+}
+
+#define I034_050_SUBFIELD(NAME, LEN, EXT, CODEC) \
+    { #NAME, (LEN), offsetof(I034_050, NAME), offsetof(I034_050, EXT), encode_##CODEC, decode_##CODEC }
+
+#define I034_050_SPARE  { "spare", 0U, 0U, 0U, NULL, NULL }
+
+/* Subfields by bit of the primary subfield */
+static const CompoundSubfield I034_050_SUBFIELDS[] =
+{
+    I034_050_SUBFIELD(COM, 1U, ext1, ext1),
+    I034_050_SPARE,
+    I034_050_SPARE,
+    I034_050_SUBFIELD(PSR, 1U, ext4, ext45),
+    I034_050_SUBFIELD(SSR, 1U, ext5, ext45),
+    I034_050_SUBFIELD(MDS, 2U, ext6, ext6),
+    I034_050_SPARE,
+};
+
+static const Compound I034_050_COMPOUND =
+{
+    "I034/050",
+    sizeof(I034_050_SUBFIELDS) / sizeof(I034_050_SUBFIELDS[0]),
+    I034_050_SUBFIELDS,
+    offsetof(I034_050, FX),
+};
+
+void encode_I034_050(BitStream *bs, const I034_050 *item)
+{
+    compound_encode(bs, &I034_050_COMPOUND, item);
 }
 
 void decode_I034_050(BitStream *bs, I034_050 *item)
 {
-    /* First octet */
-    item->COM = bs_deserialize_u32(bs, 1U);
-    bs_inc_pos(bs, 0U, 2U); /* Spare 2 bits */
-    item->PSR = bs_deserialize_u32(bs, 1U);
-    item->SSR = bs_deserialize_u32(bs, 1U);
-    item->MDS = bs_deserialize_u32(bs, 1U);
-    bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    item->FX = bs_deserialize_u32(bs, 1U);
-
-    /* Subfield #1: Common Part */
-    if(item->COM == ePresenceFlag_PRESENT)
-    {
-        item->ext1.NOGO = bs_deserialize_u32(bs, 1U);
-        item->ext1.RDPC = bs_deserialize_u32(bs, 1U);
-        item->ext1.RDPR = bs_deserialize_u32(bs, 1U);
-        item->ext1.OVLRDP = bs_deserialize_u32(bs, 1U);
-        item->ext1.OVLXMT = bs_deserialize_u32(bs, 1U);
-        item->ext1.MSC = bs_deserialize_u32(bs, 1U);
-        item->ext1.TSV = bs_deserialize_u32(bs, 1U);
-        bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    }
+    compound_decode(bs, &I034_050_COMPOUND, item);
+}
 
-    /* Subfield #4: Specific Status for PSR Sensor */
-    if(item->PSR == ePresenceFlag_PRESENT)
-    {
-        item->ext4.ANT = bs_deserialize_u32(bs, 1U);
-        item->ext4.CHAB = bs_deserialize_u32(bs, 2U);
-        item->ext4.OVL = bs_deserialize_u32(bs, 1U);
-        item->ext4.MSC = bs_deserialize_u32(bs, 1U);
-        bs_inc_pos(bs, 0U, 3); /* Spare 1 bit */
-    }
+size_t length_I034_050(BitStream *bs)
+{
+    return compound_length(bs, &I034_050_COMPOUND);
+}
 
-    /* Subfield #5: Specific Status for SSR Sensor */
-    if(item->SSR == ePresenceFlag_PRESENT)
-    {
-        item->ext5.ANT = bs_deserialize_u32(bs, 1U);
-        item->ext5.CHAB = bs_deserialize_u32(bs, 2U);
-        item->ext5.OVL = bs_deserialize_u32(bs, 1U);
-        item->ext5.MSC = bs_deserialize_u32(bs, 1U);
-        bs_inc_pos(bs, 0U, 3); /* Spare 3 bits */
-    }
+size_t encoded_size_I034_050(const I034_050 *item)
+{
+    return compound_encoded_size(&I034_050_COMPOUND, item);
+}
 
-    /* Subfield #6: Specific Status for Mode S Sensor */
-    if(item->MDS == ePresenceFlag_PRESENT)
-    {
-        item->ext6.ANT = bs_deserialize_u32(bs, 1U);
-        item->ext6.CHAB = bs_deserialize_u32(bs, 1U);
-        item->ext6.OVLSUR = bs_deserialize_u32(bs, 1U);
-        item->ext6.MSC = bs_deserialize_u32(bs, 1U);
-        item->ext6.SCF = bs_deserialize_u32(bs, 1U);
-        item->ext6.DLF = bs_deserialize_u32(bs, 1U);
-        item->ext6.OVLSCF = bs_deserialize_u32(bs, 1U);
-        item->ext6.OVLDLF = bs_deserialize_u32(bs, 1U);
-        bs_inc_pos(bs, 0U, 7); /* Spare 7 bit */
-    }
+void skip_I034_050(BitStream *bs)
+{
+    size_t len = length_I034_050(bs);
+
+    if (len != 0U)
+        bs_skip(bs, len);
 }
 
+/* ================================ METADATA =============================== */
+
+static const FieldLabel I034_050_NOGO_LABELS[]   = { { 0U, "OPR" }, { 1U, "INH" } };
+static const FieldLabel I034_050_RDPC_LABELS[]   = { { 0U, "RDPC-1" }, { 1U, "RDPC-2" } };
+static const FieldLabel I034_050_RDPR_LABELS[]   = { { 0U, "DEFAULT" }, { 1U, "RESET" } };
+static const FieldLabel I034_050_OVL_LABELS[]    = { { 0U, "NOTOVL" }, { 1U, "OVL" } };
+static const FieldLabel I034_050_MSC_LABELS[]    = { { 0U, "CONN" }, { 1U, "NOTCONN" } };
+static const FieldLabel I034_050_TSV_LABELS[]    = { { 0U, "VAL" }, { 1U, "INV" } };
+static const FieldLabel I034_050_ANT_LABELS[]    = { { 0U, "ANT1" }, { 1U, "ANT2" } };
+static const FieldLabel I034_050_CHAB_LABELS[]   = { { 0U, "NOCH" }, { 1U, "CHA" }, { 2U, "CHB" }, { 3U, "DIV" } };
+static const FieldLabel I034_050_CHANNEL_LABELS[] = { { 0U, "CHA" }, { 1U, "CHB" } };
+
+static const FieldMeta I034_050_EXT1_FIELD_META[] =
+{
+    FIELD_ENUM("NOGO",   0U, 1U, I034_050_NOGO_LABELS),
+    FIELD_ENUM("RDPC",   1U, 1U, I034_050_RDPC_LABELS),
+    FIELD_ENUM("RDPR",   2U, 1U, I034_050_RDPR_LABELS),
+    FIELD_ENUM("OVLRDP", 3U, 1U, I034_050_OVL_LABELS),
+    FIELD_ENUM("OVLXMT", 4U, 1U, I034_050_OVL_LABELS),
+    FIELD_ENUM("MSC",    5U, 1U, I034_050_MSC_LABELS),
+    FIELD_ENUM("TSV",    6U, 1U, I034_050_TSV_LABELS),
+};
+
+static const FieldMeta I034_050_EXT45_FIELD_META[] =
+{
+    FIELD_ENUM("ANT",  0U, 1U, I034_050_ANT_LABELS),
+    FIELD_ENUM("CHAB", 1U, 2U, I034_050_CHAB_LABELS),
+    FIELD_ENUM("OVL",  3U, 1U, I034_050_OVL_LABELS),
+    FIELD_ENUM("MSC",  4U, 1U, I034_050_MSC_LABELS),
+};
+
+static const FieldMeta I034_050_EXT6_FIELD_META[] =
+{
+    FIELD_ENUM("ANT",    0U, 1U, I034_050_ANT_LABELS),
+    FIELD_ENUM("CHAB",   1U, 2U, I034_050_CHAB_LABELS),
+    FIELD_ENUM("OVLSUR", 3U, 1U, I034_050_OVL_LABELS),
+    FIELD_ENUM("MSC",    4U, 1U, I034_050_MSC_LABELS),
+    FIELD_ENUM("SCF",    5U, 1U, I034_050_CHANNEL_LABELS),
+    FIELD_ENUM("DLF",    6U, 1U, I034_050_CHANNEL_LABELS),
+    FIELD_ENUM("OVLSCF", 7U, 1U, I034_050_OVL_LABELS),
+    FIELD_ENUM("OVLDLF", 8U, 1U, I034_050_OVL_LABELS),
+};
+
+/* Subfields by their member in I034_050 and bit in the primary subfield */
+static const FieldGroup I034_050_FIELD_GROUPS[] =
+{
+    FIELD_GROUP("ext1", 0U, I034_050_EXT1_FIELD_META),
+    FIELD_GROUP("ext4", 3U, I034_050_EXT45_FIELD_META),
+    FIELD_GROUP("ext5", 4U, I034_050_EXT45_FIELD_META),
+    FIELD_GROUP("ext6", 5U, I034_050_EXT6_FIELD_META),
+};
+
+const FieldItem I034_050_FIELDS =
+{
+    "I034/050", (u8)eUapItemKind_COMPOUND, 0U, &I034_050_COMPOUND, I034_050_FIELD_GROUPS, FIELD_COUNT(I034_050_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_050(const I034_050 *item)
 {
     printf("I034/050 - System Configuration and Status\n");
@@ -172,7 +236,7 @@ void print_I034_050(const I034_050 *item)
         printf("-- MSC = %u\n", item->ext5.MSC);
     }
 
-    printf("- MDS = %u\nn", item->MDS);
+    printf("- MDS = %u\n", item->MDS);
     if (item->MDS == ePresenceFlag_PRESENT)
     {
         printf("-- ANT = %u\n", item->ext6.ANT);
@@ -185,3 +249,6 @@ void print_I034_050(const I034_050 *item)
         printf("-- OVLDLF = %u\n", item->ext6.OVLDLF);
     }
 }
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_050 */
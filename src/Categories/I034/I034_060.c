@@ -6,104 +6,182 @@
  * 
  * @copyright Copyright (c) 2026
  */
+#include <stddef.h>
 #include <stdio.h>
 
 #include <Categories/I034/I034_060.h>
+#include <Categories/I034/I034_config.h>
+#include <Infra/compound.h>
+
+#if I034_WITH_060
 
 /* =============================== DE/ENCODE =============================== */
 
-void encode_I034_060(BitStream *bs, const I034_060 *item)
+/* Subfield #1: Common Part */
+static void encode_ext1(u8 *raw, const void *sub)
 {
-    /* First octet */
-    bs_serialize_u32(bs, item->COM, 1U);
-    bs_inc_pos(bs, 0U, 2U); /* Spare 2 bits */
-    bs_serialize_u32(bs, item->PSR, 1U);
-    bs_serialize_u32(bs, item->SSR, 1U);
-    bs_serialize_u32(bs, item->MDS, 1U);
-    bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    bs_serialize_u32(bs, item->FX, 1U);
-
-    /* Subfield #1: Common Part */
-    if(item->COM == ePresenceFlag_PRESENT)
-    {
-        bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-        bs_serialize_u32(bs, item->ext1.REDRDP, 3U);
-        bs_serialize_u32(bs, item->ext1.REDXMT, 3U);
-        bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    }
+    const I034_060_EXT1 *ext = (const I034_060_EXT1 *)sub;
 
-    /* Subfield #4: Specific Status for PSR Sensor */
-    if(item->PSR == ePresenceFlag_PRESENT)
-    {
-        bs_serialize_u32(bs, item->ext4.POL, 1U);
-        bs_serialize_u32(bs, item->ext4.REDRAD, 3U);
-        bs_serialize_u32(bs, item->ext4.STC, 2U);
-        bs_inc_pos(bs, 0U, 2U); /* Spare 2 bit */
-    }
+    /* Spare 1 bit, REDRDP, REDXMT, spare 1 bit */
+    raw[0] = (u8)(((ext->REDRDP & 7U) << 4U) | ((ext->REDXMT & 7U) << 1U));
+}
 
-    /* Subfield #5: Specific Status for SSR Sensor */
-    if(item->SSR == ePresenceFlag_PRESENT)
-    {
-        bs_serialize_u32(bs, item->ext5.REDRAD, 3U);
-        bs_inc_pos(bs, 0U, 5); /* Spare 5 bit */
-    }
+static void decode_ext1(const u8 *raw, void *sub)
+{
+    I034_060_EXT1 *ext = (I034_060_EXT1 *)sub;
 
-    /* Subfield #6: Specific Status for Mode S Sensor */
-    if(item->MDS == ePresenceFlag_PRESENT)
-    {
-        bs_serialize_u32(bs, item->ext6.REDRAD, 3U);
-        bs_serialize_u32(bs, item->ext6.CLU, 1U);
-        bs_inc_pos(bs, 0U, 4); /* Spare 4 bit */
-    }
+    ext->REDRDP = (u8)((raw[0] >> 4U) & 7U);
+    ext->REDXMT = (u8)((raw[0] >> 1U) & 7U);
+}
+
+/* Subfield #4: Specific Processing Mode information for PSR Sensor */
+static void encode_ext4(u8 *raw, const void *sub)
+{
+    const I034_060_EXT4 *ext = (const I034_060_EXT4 *)sub;
+
+    raw[0] = (u8)(((ext->POL & 1U) << 7U) | ((ext->REDRAD & 7U) << 4U) | ((ext->STC & 3U) << 2U)); /* Spare 2 bits */
+}
+
+static void decode_ext4(const u8 *raw, void *sub)
+{
+    I034_060_EXT4 *ext = (I034_060_EXT4 *)sub;
+
+    ext->POL = (eI034_060_EXT4_POL)((raw[0] >> 7U) & 1U);
+    ext->REDRAD = (u8)((raw[0] >> 4U) & 7U);
+    ext->STC = (eI034_060_EXT4_STC)((raw[0] >> 2U) & 3U);
+}
+
+/* Subfield #5: Specific Processing Mode information for SSR Sensor */
+static void encode_ext5(u8 *raw, const void *sub)
+{
+    const I034_060_EXT5 *ext = (const I034_060_EXT5 *)sub;
+
+    raw[0] = (u8)((ext->REDRAD & 7U) << 5U); /* Spare 5 bits */
+}
+
+static void decode_ext5(const u8 *raw, void *sub)
+{
+    I034_060_EXT5 *ext = (I034_060_EXT5 *)sub;
+
+    ext->REDRAD = (u8)((raw[0] >> 5U) & 7U);
+}
+
+/* Subfield #6: Specific Processing Mode information for Mode S Sensor */
+static void encode_ext6(u8 *raw, const void *sub)
+{
+    const I034_060_EXT6 *ext = (const I034_060_EXT6 *)sub;
+
+    raw[0] = (u8)(((ext->REDRAD & 7U) << 5U) | ((ext->CLU & 1U) << 4U)); /* Spare 4 bits */
+}
+
+static void decode_ext6(const u8 *raw, void *sub)
+{
+    I034_060_EXT6 *ext = (I034_060_EXT6 *)sub;
+
+    ext->REDRAD = (u8)((raw[0] >> 5U) & 7U);
+    ext->CLU = (eI034_060_EXT6_CLU)((raw[0] >> 4U) & 1U);
+}
+
+#define I034_060_SUBFIELD(NAME, EXT) \
+    { #NAME, 1U, offsetof(I034_060, NAME), offsetof(I034_060, EXT), encode_##EXT, decode_##EXT }
+
+#define I034_060_SPARE  { "spare", 0U, 0U, 0U, NULL, NULL }
+
+/* Subfields by bit of the primary subfield */
+static const CompoundSubfield I034_060_SUBFIELDS[] =
+{
+    I034_060_SUBFIELD(COM, ext1),
+    I034_060_SPARE,
+    I034_060_SPARE,
+    I034_060_SUBFIELD(PSR, ext4),
+    I034_060_SUBFIELD(SSR, ext5),
+    I034_060_SUBFIELD(MDS, ext6),
+    I034_060_SPARE,
+};
+
+static const Compound I034_060_COMPOUND =
+{
+    "I034/060",
+    sizeof(I034_060_SUBFIELDS) / sizeof(I034_060_SUBFIELDS[0]),
+    I034_060_SUBFIELDS,
+    offsetof(I034_060, FX),
+};
+
+void encode_I034_060(BitStream *bs, const I034_060 *item)
+{
+    compound_encode(bs, &I034_060_COMPOUND, item);
 }
 
 void decode_I034_060(BitStream *bs, I034_060 *item)
 {
-    /* First octet */
-    item->COM = bs_deserialize_u32(bs, 1U);
-    bs_inc_pos(bs, 0U, 2U); /* Spare 2 bits */
-    item->PSR = bs_deserialize_u32(bs, 1U);
-    item->SSR = bs_deserialize_u32(bs, 1U);
-    item->MDS = bs_deserialize_u32(bs, 1U);
-    bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    item->FX = bs_deserialize_u32(bs, 1U);
-
-    /* Subfield #1: Common Part */
-    if(item->COM == ePresenceFlag_PRESENT)
-    {
-        bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-        item->ext1.REDRDP = bs_deserialize_u32(bs, 3U);
-        item->ext1.REDXMT = bs_deserialize_u32(bs, 3U);
-        bs_inc_pos(bs, 0U, 1U); /* Spare 1 bit */
-    }
+    compound_decode(bs, &I034_060_COMPOUND, item);
+}
 
-    /* Subfield #4: Specific Status for PSR Sensor */
-    if(item->PSR == ePresenceFlag_PRESENT)
-    {
-        item->ext4.POL = bs_deserialize_u32(bs, 1U);
-        item->ext4.REDRAD = bs_deserialize_u32(bs, 3U);
-        item->ext4.STC = bs_deserialize_u32(bs, 2U);
-        bs_inc_pos(bs, 0U, 2U); /* Spare 2 bit */
-    }
+size_t length_I034_060(BitStream *bs)
+{
+    return compound_length(bs, &I034_060_COMPOUND);
+}
 
-    /* Subfield #5: Specific Status for SSR Sensor */
-    if(item->SSR == ePresenceFlag_PRESENT)
-    {
-        item->ext5.REDRAD = bs_deserialize_u32(bs, 3U);
-        bs_inc_pos(bs, 0U, 5); /* Spare 5 bit */
-    }
+size_t encoded_size_I034_060(const I034_060 *item)
+{
+    return compound_encoded_size(&I034_060_COMPOUND, item);
+}
 
-    /* Subfield #6: Specific Status for Mode S Sensor */
-    if(item->MDS == ePresenceFlag_PRESENT)
-    {
-        item->ext6.REDRAD = bs_deserialize_u32(bs, 3U);
-        item->ext6.CLU = bs_deserialize_u32(bs, 1U);
-        bs_inc_pos(bs, 0U, 4); /* Spare 4 bit */
-    }
+void skip_I034_060(BitStream *bs)
+{
+    size_t len = length_I034_060(bs);
+
+    if (len != 0U)
+        bs_skip(bs, len);
 }
 
+/* ================================ METADATA =============================== */
+
+static const FieldLabel I034_060_POL_LABELS[] = { { 0U, "LINEAR" }, { 1U, "CIRCULAR" } };
+static const FieldLabel I034_060_STC_LABELS[] = { { 0U, "MAP1" }, { 1U, "MAP2" }, { 2U, "MAP3" }, { 3U, "MAP4" } };
+static const FieldLabel I034_060_CLU_LABELS[] = { { 0U, "AUTO" }, { 1U, "NOT_AUTO" } };
+
+static const FieldMeta I034_060_EXT1_FIELD_META[] =
+{
+    FIELD_UNSIGNED("REDRDP", 1U, 3U, 1, 1U, NULL),
+    FIELD_UNSIGNED("REDXMT", 4U, 3U, 1, 1U, NULL),
+};
+
+static const FieldMeta I034_060_EXT4_FIELD_META[] =
+{
+    FIELD_ENUM("POL",        0U, 1U, I034_060_POL_LABELS),
+    FIELD_UNSIGNED("REDRAD", 1U, 3U, 1, 1U, NULL),
+    FIELD_ENUM("STC",        4U, 2U, I034_060_STC_LABELS),
+};
+
+static const FieldMeta I034_060_EXT5_FIELD_META[] =
+{
+    FIELD_UNSIGNED("REDRAD", 0U, 3U, 1, 1U, NULL),
+};
+
+static const FieldMeta I034_060_EXT6_FIELD_META[] =
+{
+    FIELD_UNSIGNED("REDRAD", 0U, 3U, 1, 1U, NULL),
+    FIELD_ENUM("CLU",        3U, 1U, I034_060_CLU_LABELS),
+};
+
+/* Subfields by their member in I034_060 and bit in the primary subfield */
+static const FieldGroup I034_060_FIELD_GROUPS[] =
+{
+    FIELD_GROUP("ext1", 0U, I034_060_EXT1_FIELD_META),
+    FIELD_GROUP("ext4", 3U, I034_060_EXT4_FIELD_META),
+    FIELD_GROUP("ext5", 4U, I034_060_EXT5_FIELD_META),
+    FIELD_GROUP("ext6", 5U, I034_060_EXT6_FIELD_META),
+};
+
+const FieldItem I034_060_FIELDS =
+{
+    "I034/060", (u8)eUapItemKind_COMPOUND, 0U, &I034_060_COMPOUND, I034_060_FIELD_GROUPS, FIELD_COUNT(I034_060_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_060(const I034_060 *item)
 {
     printf("I034/060 - System Configuration and Status:\n");
@@ -140,4 +218,7 @@ void print_I034_060(const I034_060 *item)
         printf("-- REDRAD: %u\n", item->ext6.REDRAD);
         printf("-- CLU: %u\n", item->ext6.CLU);
     }
-}
\ No newline at end of file
+}
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_060 */
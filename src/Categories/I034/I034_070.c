@@ -7,33 +7,124 @@
  * @copyright Copyright (c) 2026
  */
 #include <stdio.h>
+#include <string.h>
 
 #include <Categories/I034/I034_070.h>
+#include <Categories/I034/I034_config.h>
+#include <Infra/cpu_dispatch.h>
+#include <Common/constants.h>
+
+#if I034_WITH_070
 
 /* =============================== DE/ENCODE =============================== */
 
- void encode_I034_070(BitStream *bs, const I034_070 *item)
+void encode_I034_070(BitStream *bs, const I034_070 *item)
 {
-    bs_serialize_u32(bs, item->REP, 8U);
-    for (u8 i = 0U; i < item->REP; i++)
-    {
-        bs_serialize_u32(bs, item->COUNTER[i].TYP, 5U);
-        bs_serialize_u32(bs, item->COUNTER[i].COUNTER, 11U);
-    }
+    u8 tmp[2U * I034_070_MAX_REP];
+    u8 *p = NULL;
+    size_t n_bytes = 2U * (size_t)item->REP;
+
+    if (!bs_require(bs, I034_070_LEN(item->REP)))
+        return;
+
+    /* The counter words are already in wire format */
+    bs_serialize_aligned_u8(bs, item->REP);
+    p = bs_write_ptr(bs, tmp, n_bytes);
+    if (n_bytes != 0U)
+        memcpy(p, item->RAW, n_bytes);
+    bs_write_done(bs, p, tmp, n_bytes);
 }
 
 void decode_I034_070(BitStream *bs, I034_070 *item)
 {
-    item->REP = bs_deserialize_u32(bs, 8);
-    for (u8 i = 0U; i < item->REP; i++)
-    {
-        item->COUNTER[i].TYP = bs_deserialize_u32(bs, 5U);
-        item->COUNTER[i].COUNTER = bs_deserialize_u32(bs, 11U);
-    }
+    if (!bs_require(bs, 1U))
+        return;
+    item->REP = bs_deserialize_aligned_u8(bs);
+    item->RAW = NULL;
+    if (!bs_require(bs, I034_070_LEN(item->REP) - 1U))
+        return;
+
+    /* Counters stay where they are: they are unpacked on demand */
+    if (item->REP != 0U)
+        item->RAW = bs_ref_ptr(bs, 2U * (size_t)item->REP);
+}
+
+size_t length_I034_070(BitStream *bs)
+{
+    if (!bs_require(bs, 1U))
+        return 0U;
+    return I034_070_LEN(bs_peek_aligned_u8(bs, 0U));
+}
+
+size_t encoded_size_I034_070(const I034_070 *item)
+{
+    return I034_070_LEN(item->REP);
 }
 
+void skip_I034_070(BitStream *bs)
+{
+    size_t len = length_I034_070(bs);
+
+    if (len != 0U)
+        bs_skip(bs, len);
+}
+
+void unpack_I034_070(const I034_070 *item, u16 *words)
+{
+    /* All the counters are unpacked at once by the dispatched kernel */
+    if (item->REP != 0U)
+        asterix_be16_unpack(words, item->RAW, item->REP);
+}
+
+/* ================================ METADATA =============================== */
+
+#define I034_070_LABEL(NAME)    { (u32)eI034_070_TYP_##NAME, #NAME }
+
+static const FieldLabel I034_070_TYP_LABELS[] =
+{
+    I034_070_LABEL(MISSES),
+    I034_070_LABEL(SING_PSR_REP),
+    I034_070_LABEL(SING_SSR_REP),
+    I034_070_LABEL(SSR_PSR_REP),
+    I034_070_LABEL(SING_ACALL_REP),
+    I034_070_LABEL(SING_RCALL_REP),
+    I034_070_LABEL(ACALL_PSR_REP),
+    I034_070_LABEL(RCALL_PSR_REP),
+    I034_070_LABEL(FIL_WEATHER),
+    I034_070_LABEL(FIL_JAMM_STR),
+    I034_070_LABEL(FIL_PSR),
+    I034_070_LABEL(FIL_SSR_MS),
+    I034_070_LABEL(FIL_SSR_MS_PSR),
+    I034_070_LABEL(FIL_ENHS),
+    I034_070_LABEL(FIL_PSR_ENHS),
+    I034_070_LABEL(FIL_PSR_ENHS_SSRMS),
+    I034_070_LABEL(FIL_PSR_ENHS_MS),
+    I034_070_LABEL(REINT),
+    I034_070_LABEL(BDSSWAP_WRONGDFREP),
+    I034_070_LABEL(MODEAC_FRUIT),
+    I034_070_LABEL(MS_FRUIT),
+};
+
+/* Fields of one counter word */
+static const FieldMeta I034_070_FIELD_META[] =
+{
+    FIELD_ENUM("TYP",         0U, 5U, I034_070_TYP_LABELS),
+    FIELD_UNSIGNED("COUNTER", 5U, 11U, 1, 1U, NULL),
+};
+
+static const FieldGroup I034_070_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_070_FIELD_META),
+};
+
+const FieldItem I034_070_FIELDS =
+{
+    "I034/070", (u8)eUapItemKind_REPETITIVE, 2U, NULL, I034_070_FIELD_GROUPS, FIELD_COUNT(I034_070_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_070(const I034_070 *item)
 {
     printf("I034/070 - Message Count Values\n");
@@ -46,7 +137,11 @@ void print_I034_070(const I034_070 *item)
     printf("- REP = %u\n", item->REP);
     for (u8 i = 0U; i < item->REP; i++)
     {
+        I034_070_COUNTER counter = get_I034_070_COUNTER(item, i);
         printf("-- COUNTER[%d] : TYP = %u | COUNTER = %u\n",
-            i + 1, item->COUNTER[i].TYP, item->COUNTER[i].COUNTER);
+            i + 1, counter.TYP, counter.COUNTER);
     }
-}
\ No newline at end of file
+}
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_070 */
@@ -9,23 +9,68 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_090.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_090
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_090(BitStream *bs, const I034_090 *item)
 {
-    bs_serialize_sfloat(bs, item->RANGEERR, I034_090_LSB_RANGEERR, 8U);
-    bs_serialize_sfloat(bs, item->AZERR, I034_090_LSB_AZERR, 8U);
+    bs_serialize_aligned_s8(bs, get_I034_090_RANGEERR_raw(item));
+    bs_serialize_aligned_s8(bs, get_I034_090_AZERR_raw(item));
 }
 
 void decode_I034_090(BitStream *bs, I034_090 *item)
 {
-    item->RANGEERR = bs_deserialize_sfloat(bs, I034_090_LSB_RANGEERR, 8U);
-    item->AZERR = bs_deserialize_sfloat(bs, I034_090_LSB_AZERR, 8U);
+    u8 tmp[I034_090_LEN];
+    read_I034_090(bs_read_ptr(bs, tmp, I034_090_LEN), item);
+}
+
+void read_I034_090(const u8 *raw, I034_090 *item)
+{
+    set_I034_090_RANGEERR_raw(item, (s8)raw[0U]);
+    set_I034_090_AZERR_raw(item, (s8)raw[1U]);
 }
 
+size_t length_I034_090(BitStream *bs)
+{
+    (void)bs;
+    return I034_090_LEN;
+}
+
+size_t encoded_size_I034_090(const I034_090 *item)
+{
+    (void)item;
+    return I034_090_LEN;
+}
+
+void skip_I034_090(BitStream *bs)
+{
+    bs_skip(bs, I034_090_LEN);
+}
+
+/* ================================ METADATA =============================== */
+
+static const FieldMeta I034_090_FIELD_META[] =
+{
+    FIELD_SIGNED("RANGEERR", 0U, 8U,  1, 128U,  "NM"),
+    FIELD_SIGNED("AZERR",    8U, 8U, 45, 2048U, "deg"),  /* 360/2^14 */
+};
+
+static const FieldGroup I034_090_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_090_FIELD_META),
+};
+
+const FieldItem I034_090_FIELDS =
+{
+    "I034/090", (u8)eUapItemKind_FIXED, 0U, NULL, I034_090_FIELD_GROUPS, FIELD_COUNT(I034_090_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_090(const I034_090 *item)
 {
     printf("I034/090 - Collimation Error:\n");
@@ -34,6 +79,14 @@ void print_I034_090(const I034_090 *item)
         printf("I034/090: <null>\n");
         return;
     }
-    printf("- RANGE ERROR: %.3f NM\n", item->RANGEERR);
-    printf("- AZIMUTH ERROR: %.3f degrees\n", item->AZERR);
+#ifdef ASTERIX_NO_FLOAT
+    printf("- RANGE ERROR: %d x 1/128 NM\n", (int)get_I034_090_RANGEERR_raw(item));
+    printf("- AZIMUTH ERROR: %d x 360/2^14 degrees\n", (int)get_I034_090_AZERR_raw(item));
+#else
+    printf("- RANGE ERROR: %.3f NM\n", get_I034_090_RANGEERR(item));
+    printf("- AZIMUTH ERROR: %.3f degrees\n", get_I034_090_AZERR(item));
+#endif
 }
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_090 */
@@ -9,27 +9,74 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_100.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_100
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_100(BitStream *bs, const I034_100 *item)
 {
-    bs_serialize_ufloat(bs, item->RHO_START, I034_100_LSB_RHO, 16U);
-    bs_serialize_ufloat(bs, item->RHO_END, I034_100_LSB_RHO, 16U);
-    bs_serialize_ufloat(bs, item->THETA_START, I034_100_LSB_THETA, 16U);
-    bs_serialize_ufloat(bs, item->THETA_END, I034_100_LSB_THETA, 16U);
+    bs_serialize_aligned_u16(bs, get_I034_100_RHO_START_raw(item));
+    bs_serialize_aligned_u16(bs, get_I034_100_RHO_END_raw(item));
+    bs_serialize_aligned_u16(bs, get_I034_100_THETA_START_raw(item));
+    bs_serialize_aligned_u16(bs, get_I034_100_THETA_END_raw(item));
 }
 
 void decode_I034_100(BitStream *bs, I034_100 *item)
 {
-    item->RHO_START = bs_deserialize_ufloat(bs, I034_100_LSB_RHO, 16U);
-    item->RHO_END = bs_deserialize_ufloat(bs, I034_100_LSB_RHO, 16U);
-    item->THETA_START = bs_deserialize_ufloat(bs, I034_100_LSB_THETA, 16U);
-    item->THETA_END = bs_deserialize_ufloat(bs, I034_100_LSB_THETA, 16U);    
+    u8 tmp[I034_100_LEN];
+    read_I034_100(bs_read_ptr(bs, tmp, I034_100_LEN), item);
+}
+
+void read_I034_100(const u8 *raw, I034_100 *item)
+{
+    set_I034_100_RHO_START_raw(item, bs_load_u16(&raw[0U]));
+    set_I034_100_RHO_END_raw(item, bs_load_u16(&raw[2U]));
+    set_I034_100_THETA_START_raw(item, bs_load_u16(&raw[4U]));
+    set_I034_100_THETA_END_raw(item, bs_load_u16(&raw[6U]));
+}
+
+size_t length_I034_100(BitStream *bs)
+{
+    (void)bs;
+    return I034_100_LEN;
+}
+
+size_t encoded_size_I034_100(const I034_100 *item)
+{
+    (void)item;
+    return I034_100_LEN;
+}
+
+void skip_I034_100(BitStream *bs)
+{
+    bs_skip(bs, I034_100_LEN);
 }
 
+/* ================================ METADATA =============================== */
+
+static const FieldMeta I034_100_FIELD_META[] =
+{
+    FIELD_UNSIGNED("RHO_START",    0U, 16U,  1, 256U,  "NM"),
+    FIELD_UNSIGNED("RHO_END",     16U, 16U,  1, 256U,  "NM"),
+    FIELD_UNSIGNED("THETA_START", 32U, 16U, 45, 8192U, "deg"),  /* 360/2^16 */
+    FIELD_UNSIGNED("THETA_END",   48U, 16U, 45, 8192U, "deg"),
+};
+
+static const FieldGroup I034_100_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_100_FIELD_META),
+};
+
+const FieldItem I034_100_FIELDS =
+{
+    "I034/100", (u8)eUapItemKind_FIXED, 0U, NULL, I034_100_FIELD_GROUPS, FIELD_COUNT(I034_100_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_100(const I034_100 *item)
 {
     printf("I034/100 - Generic Polar Window:\n");
@@ -38,8 +85,18 @@ void print_I034_100(const I034_100 *item)
         printf("I034/100: <null>\n");
         return;
     }
-    printf("- RHO START: %.3f NM\n", item->RHO_START);
-    printf("- RHO END: %.3f NM\n", item->RHO_END);
-    printf("- THETA START: %.4f degrees\n", item->THETA_START);
-    printf("- THETA END: %.4f degrees\n", item->THETA_END);
-}
\ No newline at end of file
+#ifdef ASTERIX_NO_FLOAT
+    printf("- RHO START: %u x 1/256 NM\n", (unsigned)get_I034_100_RHO_START_raw(item));
+    printf("- RHO END: %u x 1/256 NM\n", (unsigned)get_I034_100_RHO_END_raw(item));
+    printf("- THETA START: %u x 360/2^16 degrees\n", (unsigned)get_I034_100_THETA_START_raw(item));
+    printf("- THETA END: %u x 360/2^16 degrees\n", (unsigned)get_I034_100_THETA_END_raw(item));
+#else
+    printf("- RHO START: %.3f NM\n", get_I034_100_RHO_START(item));
+    printf("- RHO END: %.3f NM\n", get_I034_100_RHO_END(item));
+    printf("- THETA START: %.4f degrees\n", get_I034_100_THETA_START(item));
+    printf("- THETA END: %.4f degrees\n", get_I034_100_THETA_END(item));
+#endif
+}
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_100 */
@@ -9,21 +9,80 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_110.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_110
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_110(BitStream *bs, const I034_110 *item)
 {
-    bs_serialize_u32(bs, item->TYP, 8U);
+    bs_serialize_aligned_u8(bs, (u8)item->TYP);
 }
 
 void decode_I034_110(BitStream *bs, I034_110 *item)
 {
-    item->TYP = bs_deserialize_u32(bs, 8U);
+    u8 tmp[I034_110_LEN];
+    read_I034_110(bs_read_ptr(bs, tmp, I034_110_LEN), item);
+}
+
+void read_I034_110(const u8 *raw, I034_110 *item)
+{
+    item->TYP = (eI034_110_TYP)raw[0U];
+}
+
+size_t length_I034_110(BitStream *bs)
+{
+    (void)bs;
+    return I034_110_LEN;
+}
+
+size_t encoded_size_I034_110(const I034_110 *item)
+{
+    (void)item;
+    return I034_110_LEN;
+}
+
+void skip_I034_110(BitStream *bs)
+{
+    bs_skip(bs, I034_110_LEN);
 }
 
+/* ================================ METADATA =============================== */
+
+#define I034_110_LABEL(NAME)    { (u32)eI034_110_TYP_##NAME, #NAME }
+
+static const FieldLabel I034_110_TYP_LABELS[] =
+{
+    I034_110_LABEL(WEATHER),
+    I034_110_LABEL(JAMM_STR),
+    I034_110_LABEL(PSR),
+    I034_110_LABEL(SSR_MS),
+    I034_110_LABEL(SSR_MS_PSR),
+    I034_110_LABEL(ENHS),
+    I034_110_LABEL(PSR_ENHS),
+    I034_110_LABEL(PSR_ENHS_SSRMS),
+    I034_110_LABEL(PSR_ENHS_MS),
+};
+
+static const FieldMeta I034_110_FIELD_META[] =
+{
+    FIELD_ENUM("TYP", 0U, 8U, I034_110_TYP_LABELS),
+};
+
+static const FieldGroup I034_110_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_110_FIELD_META),
+};
+
+const FieldItem I034_110_FIELDS =
+{
+    "I034/110", (u8)eUapItemKind_FIXED, 0U, NULL, I034_110_FIELD_GROUPS, FIELD_COUNT(I034_110_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_110(const I034_110 *item)
 {
     printf("I034/110 - Data Filter\n");
@@ -34,4 +93,7 @@ void print_I034_110(const I034_110 *item)
     }
 
     printf("- Data Filter Type (TYP): %u\n", item->TYP);
-}
\ No newline at end of file
+}
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_110 */
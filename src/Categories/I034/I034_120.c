@@ -9,25 +9,71 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_120.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_120
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_120(BitStream *bs, const I034_120 *item)
 {
-    bs_serialize_u16(bs, item->HEIGHT, 16U);
-    bs_serialize_sfloat(bs, item->LATWGS84, I034_120_LSB_LATWGS84, 24U);
-    bs_serialize_sfloat(bs, item->LONWGS84, I034_120_LSB_LONWGS84, 24U);
+    bs_serialize_aligned_s16(bs, item->HEIGHT);
+    bs_serialize_aligned_s24(bs, get_I034_120_LATWGS84_raw(item));
+    bs_serialize_aligned_s24(bs, get_I034_120_LONWGS84_raw(item));
 }
 
 void decode_I034_120(BitStream *bs, I034_120 *item)
 {
-    item->HEIGHT = bs_deserialize_u16(bs, 16U);
-    item->LATWGS84 = bs_deserialize_sfloat(bs, I034_120_LSB_LATWGS84, 24U);
-    item->LONWGS84 = bs_deserialize_sfloat(bs, I034_120_LSB_LONWGS84, 24U);
+    u8 tmp[I034_120_LEN];
+    read_I034_120(bs_read_ptr(bs, tmp, I034_120_LEN), item);
+}
+
+void read_I034_120(const u8 *raw, I034_120 *item)
+{
+    item->HEIGHT = (s16)bs_load_u16(&raw[0U]);
+    set_I034_120_LATWGS84_raw(item, bs_load_s24(&raw[2U]));
+    set_I034_120_LONWGS84_raw(item, bs_load_s24(&raw[5U]));
 }
 
+size_t length_I034_120(BitStream *bs)
+{
+    (void)bs;
+    return I034_120_LEN;
+}
+
+size_t encoded_size_I034_120(const I034_120 *item)
+{
+    (void)item;
+    return I034_120_LEN;
+}
+
+void skip_I034_120(BitStream *bs)
+{
+    bs_skip(bs, I034_120_LEN);
+}
+
+/* ================================ METADATA =============================== */
+
+static const FieldMeta I034_120_FIELD_META[] =
+{
+    FIELD_SIGNED("HEIGHT",    0U, 16U,  1, 1U,       "m"),
+    FIELD_SIGNED("LATWGS84", 16U, 24U, 45, 2097152U, "deg"),    /* 180/2^23 */
+    FIELD_SIGNED("LONWGS84", 40U, 24U, 45, 2097152U, "deg"),
+};
+
+static const FieldGroup I034_120_FIELD_GROUPS[] =
+{
+    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, I034_120_FIELD_META),
+};
+
+const FieldItem I034_120_FIELDS =
+{
+    "I034/120", (u8)eUapItemKind_FIXED, 0U, NULL, I034_120_FIELD_GROUPS, FIELD_COUNT(I034_120_FIELD_GROUPS),
+};
+
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_120(const I034_120 *item)
 {
     printf("I034/120 - 3D-Position of Data Source\n");
@@ -37,6 +83,14 @@ void print_I034_120(const I034_120 *item)
         return;
     }
     printf("- HEIGHT WGS84 = %d\n", item->HEIGHT);
-    printf("- LATITUDE WGS84 = %f\n", item->LATWGS84);
-    printf("- LONGITUDE WGS84 = %f\n", item->LONWGS84);
+#ifdef ASTERIX_NO_FLOAT
+    printf("- LATITUDE WGS84 = %ld x 180/2^23\n", (long)get_I034_120_LATWGS84_raw(item));
+    printf("- LONGITUDE WGS84 = %ld x 180/2^23\n", (long)get_I034_120_LONWGS84_raw(item));
+#else
+    printf("- LATITUDE WGS84 = %f\n", get_I034_120_LATWGS84(item));
+    printf("- LONGITUDE WGS84 = %f\n", get_I034_120_LONWGS84(item));
+#endif
 }
+#endif /* I034_WITH_PRINT */
+
+#endif /* I034_WITH_120 */
@@ -0,0 +1,27 @@
+/**
+ * @file I034_Builder.c
+ * @brief Category 034 records written item by item, without an I034 structure
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include <Categories/I034/I034_Builder.h>
+
+/* =============================== DE/ENCODE =============================== */
+
+eAsterixStatus begin_I034(I034_Builder *builder, BitStream *bs)
+{
+    return uap_builder_begin(builder, bs, &I034_UAP);
+}
+
+eAsterixStatus end_I034(I034_Builder *builder)
+{
+    // FSPEC
+    if (uap_builder_end(builder) == eAsterixStatus_OK)
+    {
+        // HEADER (CAT and LEN)
+        bs_serialize_header(builder->bs, I034_UAP.cat);
+    }
+    return bs_status(builder->bs);
+}
@@ -0,0 +1,461 @@
+/**
+ * @file I034_Compact.c
+ * @brief Compact in-memory layout of decoded Category 034 messages
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include <string.h>
+
+#include <Categories/I034/I034_Compact.h>
+
+/* Layout regression checks: the hot part must stay within one cache line, the
+ * cold part within two, and the packed status items must not fall back to
+ * 4-octet enums */
+ASTERIX_STATIC_ASSERT(sizeof(I034_Compact) <= I034_COMPACT_MAX_SIZE, I034_Compact_size);
+ASTERIX_STATIC_ASSERT(sizeof(I034_050_Compact) == 27U, I034_050_Compact_size);
+ASTERIX_STATIC_ASSERT(sizeof(I034_060_Compact) == 12U, I034_060_Compact_size);
+ASTERIX_STATIC_ASSERT(sizeof(I034_CompactCold) <= 2U * I034_COMPACT_MAX_SIZE, I034_CompactCold_size);
+
+/* ================================= ITEMS ================================= */
+
+/* Store each decoded item in the compact layout (ctx is the I034_Compact) */
+
+static void on_I034_010(void *ctx, const I034_010 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_010);
+    rec->SAC = item->SAC;
+    rec->SIC = item->SIC;
+}
+
+static void on_I034_000(void *ctx, const I034_000 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_000);
+    rec->MSGTYPE = (u8)item->MSGTYPE;
+}
+
+static void on_I034_030(void *ctx, const I034_030 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_030);
+    rec->TOD = get_I034_030_TOD_raw(item);
+}
+
+static void on_I034_020(void *ctx, const I034_020 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_020);
+    rec->SECTAZ = get_I034_020_SECTAZ_raw(item);
+}
+
+static void on_I034_041(void *ctx, const I034_041 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_041);
+    rec->ANTROTSPD = get_I034_041_ANTROTSPD_raw(item);
+}
+
+static void on_I034_050(void *ctx, const I034_050 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+    I034_050_Compact *out = &rec->cold->I034_050;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_050);
+    out->COM = (u8)item->COM;
+    out->PSR = (u8)item->PSR;
+    out->SSR = (u8)item->SSR;
+    out->MDS = (u8)item->MDS;
+    out->ext1.NOGO = (u8)item->ext1.NOGO;
+    out->ext1.RDPC = (u8)item->ext1.RDPC;
+    out->ext1.RDPR = (u8)item->ext1.RDPR;
+    out->ext1.OVLRDP = (u8)item->ext1.OVLRDP;
+    out->ext1.OVLXMT = (u8)item->ext1.OVLXMT;
+    out->ext1.MSC = (u8)item->ext1.MSC;
+    out->ext1.TSV = (u8)item->ext1.TSV;
+    out->ext4.ANT = (u8)item->ext4.ANT;
+    out->ext4.CHAB = (u8)item->ext4.CHAB;
+    out->ext4.OVL = (u8)item->ext4.OVL;
+    out->ext4.MSC = (u8)item->ext4.MSC;
+    out->ext5.ANT = (u8)item->ext5.ANT;
+    out->ext5.CHAB = (u8)item->ext5.CHAB;
+    out->ext5.OVL = (u8)item->ext5.OVL;
+    out->ext5.MSC = (u8)item->ext5.MSC;
+    out->ext6.ANT = (u8)item->ext6.ANT;
+    out->ext6.CHAB = (u8)item->ext6.CHAB;
+    out->ext6.OVLSUR = (u8)item->ext6.OVLSUR;
+    out->ext6.MSC = (u8)item->ext6.MSC;
+    out->ext6.SCF = (u8)item->ext6.SCF;
+    out->ext6.DLF = (u8)item->ext6.DLF;
+    out->ext6.OVLSCF = (u8)item->ext6.OVLSCF;
+    out->ext6.OVLDLF = (u8)item->ext6.OVLDLF;
+}
+
+static void on_I034_060(void *ctx, const I034_060 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+    I034_060_Compact *out = &rec->cold->I034_060;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_060);
+    out->COM = (u8)item->COM;
+    out->PSR = (u8)item->PSR;
+    out->SSR = (u8)item->SSR;
+    out->MDS = (u8)item->MDS;
+    out->ext1.REDRDP = item->ext1.REDRDP;
+    out->ext1.REDXMT = item->ext1.REDXMT;
+    out->ext4.POL = (u8)item->ext4.POL;
+    out->ext4.REDRAD = item->ext4.REDRAD;
+    out->ext4.STC = (u8)item->ext4.STC;
+    out->ext5.REDRAD = item->ext5.REDRAD;
+    out->ext6.REDRAD = item->ext6.REDRAD;
+    out->ext6.CLU = (u8)item->ext6.CLU;
+}
+
+static void on_I034_070(void *ctx, const I034_070 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+    I034_CompactCold *cold = rec->cold;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_070);
+    cold->REP = item->REP;
+    cold->RAW = item->RAW;
+}
+
+static void on_I034_100(void *ctx, const I034_100 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_100);
+    rec->cold->RHO_START = get_I034_100_RHO_START_raw(item);
+    rec->cold->RHO_END = get_I034_100_RHO_END_raw(item);
+    rec->cold->THETA_START = get_I034_100_THETA_START_raw(item);
+    rec->cold->THETA_END = get_I034_100_THETA_END_raw(item);
+}
+
+static void on_I034_110(void *ctx, const I034_110 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_110);
+    rec->cold->TYP = (u8)item->TYP;
+}
+
+static void on_I034_120(void *ctx, const I034_120 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_120);
+    rec->cold->HEIGHT = item->HEIGHT;
+    rec->cold->LATWGS84 = get_I034_120_LATWGS84_raw(item);
+    rec->cold->LONWGS84 = get_I034_120_LONWGS84_raw(item);
+}
+
+static void on_I034_090(void *ctx, const I034_090 *item)
+{
+    I034_Compact *rec = (I034_Compact *)ctx;
+
+    rec->present |= (u16)UAP_FRN_BIT(eI034_FRN_I034_090);
+    rec->cold->RANGEERR = get_I034_090_RANGEERR_raw(item);
+    rec->cold->AZERR = get_I034_090_AZERR_raw(item);
+}
+
+/* =============================== DE/ENCODE =============================== */
+
+/* Longest run of fixed-length items a record can start with (all of them) */
+#define I034_COMPACT_FIXED_LEN  (I034_010_LEN + I034_000_LEN + I034_030_LEN + I034_020_LEN + \
+                                 I034_041_LEN + I034_100_LEN + I034_110_LEN + I034_120_LEN + \
+                                 I034_090_LEN)
+
+/* Store the fixed-length item of the given FRN from its raw octets; the cold
+ * ones are dropped if there is no cold part */
+static void decode_I034_compact_fixed(I034_Compact *item, size_t frn, const u8 *raw)
+{
+    I034_CompactCold *cold = item->cold;
+
+    switch (frn)
+    {
+        case eI034_FRN_I034_010:
+            item->SAC = raw[0U];
+            item->SIC = raw[1U];
+            break;
+        case eI034_FRN_I034_000:
+            item->MSGTYPE = raw[0U];
+            break;
+        case eI034_FRN_I034_030:
+            item->TOD = bs_load_u24(raw);
+            break;
+        case eI034_FRN_I034_020:
+            item->SECTAZ = raw[0U];
+            break;
+        case eI034_FRN_I034_041:
+            item->ANTROTSPD = bs_load_u16(raw);
+            break;
+        case eI034_FRN_I034_100:
+            if (cold == NULL)
+                return;
+            cold->RHO_START = bs_load_u16(&raw[0U]);
+            cold->RHO_END = bs_load_u16(&raw[2U]);
+            cold->THETA_START = bs_load_u16(&raw[4U]);
+            cold->THETA_END = bs_load_u16(&raw[6U]);
+            break;
+        case eI034_FRN_I034_110:
+            if (cold == NULL)
+                return;
+            cold->TYP = raw[0U];
+            break;
+        case eI034_FRN_I034_120:
+            if (cold == NULL)
+                return;
+            cold->HEIGHT = (s16)bs_load_u16(&raw[0U]);
+            cold->LATWGS84 = bs_load_s24(&raw[2U]);
+            cold->LONWGS84 = bs_load_s24(&raw[5U]);
+            break;
+        case eI034_FRN_I034_090:
+            if (cold == NULL)
+                return;
+            cold->RANGEERR = (s8)raw[0U];
+            cold->AZERR = (s8)raw[1U];
+            break;
+        default:
+            return;
+    }
+    item->present |= (u16)UAP_FRN_BIT(frn);
+}
+
+/* Decode the variable-length item of the given FRN into the cold part, or
+ * skip it if there is none (RE and SP are always skipped) */
+static void decode_I034_compact_variable(BitStream *bs, I034_Compact *item, size_t frn)
+{
+    const UapItem *it = &I034_UAP.items[frn - 1U];
+    union
+    {
+        I034_050 i050;
+        I034_060 i060;
+        I034_070 i070;
+    } tmp;
+    size_t len = 0U;
+
+    if (item->cold != NULL)
+    {
+        switch (frn)
+        {
+            case eI034_FRN_I034_050:
+                it->decode(bs, &tmp.i050);
+                if (bs_status(bs) == eAsterixStatus_OK)
+                    on_I034_050(item, &tmp.i050);
+                return;
+            case eI034_FRN_I034_060:
+                it->decode(bs, &tmp.i060);
+                if (bs_status(bs) == eAsterixStatus_OK)
+                    on_I034_060(item, &tmp.i060);
+                return;
+            case eI034_FRN_I034_070:
+                it->decode(bs, &tmp.i070);
+                if (bs_status(bs) == eAsterixStatus_OK)
+                    on_I034_070(item, &tmp.i070);
+                return;
+            default:
+                break;
+        }
+    }
+
+    len = it->length(bs);
+    if (len != 0U)
+        bs_skip(bs, len);
+}
+
+/* Decode the given items one at a time, in FRN order */
+static void decode_I034_compact_items(BitStream *bs, I034_Compact *item, u64 present)
+{
+    u8 tmp[I034_COMPACT_FIXED_LEN];
+
+    while ((present != 0U) && (bs_status(bs) == eAsterixStatus_OK))
+    {
+        size_t frn = uap_ctz64(present) + 1U;
+        const UapItem *it = &I034_UAP.items[frn - 1U];
+
+        present &= present - 1U;
+        if (it->kind != eUapItemKind_FIXED)
+            decode_I034_compact_variable(bs, item, frn);
+        else if (bs_require(bs, it->len))
+            decode_I034_compact_fixed(item, frn, bs_read_ptr(bs, tmp, it->len));
+    }
+}
+
+eAsterixStatus decode_I034_compact(BitStream *bs, I034_Compact *item, I034_CompactCold *cold)
+{
+    u8 tmp[I034_COMPACT_FIXED_LEN];
+    const UapPlan *plan = NULL;
+    const u8 *data = NULL;
+    size_t start = 0U;
+    size_t i = 0U;
+    u64 present = 0U;
+
+    memset(item, 0, sizeof(*item));
+    item->cold = cold;
+
+    // HEADER (CAT and LEN), validated once for the whole data block
+    if (bs_validate_block(bs) != eAsterixStatus_OK)
+        return bs_status(bs);
+    item->LEN = (u16)bs->limit;
+
+    // FSPEC
+    if (uap_decode_fspec(bs, &I034_UAP, &present) != eAsterixStatus_OK)
+        return bs_status(bs);
+
+    // ITEMS, one at a time without a plan
+    plan = uap_plan(&I034_UAP, present);
+    if (plan == NULL)
+    {
+        decode_I034_compact_items(bs, item, present);
+        return bs_status(bs);
+    }
+
+    // LEADING FIXED ITEMS, straight from the wire at their offsets in the plan
+    start = bs->byte_pos;
+    if (!bs_require(bs, plan->fixed_len))
+        return bs_status(bs);
+    data = bs_fast_ptr(bs, start, plan->fixed_len);
+    if (data == NULL)
+    {
+        _bs_gather(bs, start, tmp, plan->fixed_len);
+        data = tmp;
+    }
+    for (i = 0U; i < plan->n_fixed; i++)
+    {
+        decode_I034_compact_fixed(item, plan->index[i] + 1U, data + plan->offset[i]);
+        present &= present - 1U;
+    }
+    bs->byte_pos = start + plan->fixed_len;
+
+    // OTHER ITEMS, from the first variable-length one
+    decode_I034_compact_items(bs, item, present);
+    return bs_status(bs);
+}
+
+#undef I034_COMPACT_FIXED_LEN
+
+/* ============================== EXTRA FUNCS ============================== */
+
+void compact_I034(const I034 *rec, I034_Compact *item, I034_CompactCold *cold)
+{
+    memset(item, 0, sizeof(*item));
+    item->cold = cold;
+    item->LEN = rec->HEADER.LEN;
+
+#define I034_COMPACT_ITEM(ID)                                       \
+    if (I034_FSPEC_GET(&rec->FSPEC, I034_##ID))                     \
+        on_I034_##ID(item, &rec->I034_##ID);
+
+    I034_COMPACT_ITEM(010)
+    I034_COMPACT_ITEM(000)
+    I034_COMPACT_ITEM(030)
+    I034_COMPACT_ITEM(020)
+    I034_COMPACT_ITEM(041)
+    if (cold != NULL)
+    {
+        I034_COMPACT_ITEM(050)
+        I034_COMPACT_ITEM(060)
+        I034_COMPACT_ITEM(070)
+        I034_COMPACT_ITEM(100)
+        I034_COMPACT_ITEM(110)
+        I034_COMPACT_ITEM(120)
+        I034_COMPACT_ITEM(090)
+    }
+
+#undef I034_COMPACT_ITEM
+}
+
+static void expand_I034_050(const I034_050_Compact *in, I034_050 *out)
+{
+    out->COM = (ePresenceFlag)in->COM;
+    out->PSR = (ePresenceFlag)in->PSR;
+    out->SSR = (ePresenceFlag)in->SSR;
+    out->MDS = (ePresenceFlag)in->MDS;
+    out->ext1.NOGO = (eI034_050_EXT1_NOGO)in->ext1.NOGO;
+    out->ext1.RDPC = (eI034_050_EXT1_RDPC)in->ext1.RDPC;
+    out->ext1.RDPR = (eI034_050_EXT1_RDPR)in->ext1.RDPR;
+    out->ext1.OVLRDP = (eI034_050_EXT1_OVLRDP)in->ext1.OVLRDP;
+    out->ext1.OVLXMT = (eI034_050_EXT1_OVLXMT)in->ext1.OVLXMT;
+    out->ext1.MSC = (eI034_050_EXT1_MSC)in->ext1.MSC;
+    out->ext1.TSV = (eI034_050_EXT1_TSV)in->ext1.TSV;
+    out->ext4.ANT = (eI034_050_EXT45_ANT)in->ext4.ANT;
+    out->ext4.CHAB = (eI034_050_EXT45_CHAB)in->ext4.CHAB;
+    out->ext4.OVL = (eI034_050_EXT45_OVL)in->ext4.OVL;
+    out->ext4.MSC = (eI034_050_EXT45_MSC)in->ext4.MSC;
+    out->ext5.ANT = (eI034_050_EXT45_ANT)in->ext5.ANT;
+    out->ext5.CHAB = (eI034_050_EXT45_CHAB)in->ext5.CHAB;
+    out->ext5.OVL = (eI034_050_EXT45_OVL)in->ext5.OVL;
+    out->ext5.MSC = (eI034_050_EXT45_MSC)in->ext5.MSC;
+    out->ext6.ANT = (eI034_050_EXT6_ANT)in->ext6.ANT;
+    out->ext6.CHAB = (eI034_050_EXT6_CHAB)in->ext6.CHAB;
+    out->ext6.OVLSUR = (eI034_050_EXT6_OVLSUR)in->ext6.OVLSUR;
+    out->ext6.MSC = (eI034_050_EXT6_MSC)in->ext6.MSC;
+    out->ext6.SCF = (eI034_050_EXT6_SCF)in->ext6.SCF;
+    out->ext6.DLF = (eI034_050_EXT6_DLF)in->ext6.DLF;
+    out->ext6.OVLSCF = (eI034_050_EXT6_OVLSCF)in->ext6.OVLSCF;
+    out->ext6.OVLDLF = (eI034_050_EXT6_OVLDLF)in->ext6.OVLDLF;
+}
+
+static void expand_I034_060(const I034_060_Compact *in, I034_060 *out)
+{
+    out->COM = (ePresenceFlag)in->COM;
+    out->PSR = (ePresenceFlag)in->PSR;
+    out->SSR = (ePresenceFlag)in->SSR;
+    out->MDS = (ePresenceFlag)in->MDS;
+    out->ext1.REDRDP = in->ext1.REDRDP;
+    out->ext1.REDXMT = in->ext1.REDXMT;
+    out->ext4.POL = (eI034_060_EXT4_POL)in->ext4.POL;
+    out->ext4.REDRAD = in->ext4.REDRAD;
+    out->ext4.STC = (eI034_060_EXT4_STC)in->ext4.STC;
+    out->ext5.REDRAD = in->ext5.REDRAD;
+    out->ext6.REDRAD = in->ext6.REDRAD;
+    out->ext6.CLU = (eI034_060_EXT6_CLU)in->ext6.CLU;
+}
+
+void expand_I034_compact(const I034_Compact *item, I034 *rec)
+{
+    const I034_CompactCold *cold = item->cold;
+
+    memset(rec, 0, sizeof(*rec));
+    rec->HEADER.CAT = I034_UAP.cat;
+    rec->HEADER.LEN = item->LEN;
+    rec->FSPEC.present = item->present;
+
+    rec->I034_010.SAC = item->SAC;
+    rec->I034_010.SIC = item->SIC;
+    rec->I034_000.MSGTYPE = (eI034_000_MSG_TYPE)item->MSGTYPE;
+    set_I034_030_TOD_raw(&rec->I034_030, item->TOD);
+    set_I034_020_SECTAZ_raw(&rec->I034_020, item->SECTAZ);
+    set_I034_041_ANTROTSPD_raw(&rec->I034_041, item->ANTROTSPD);
+
+    if (cold == NULL)
+    {
+        rec->FSPEC.present &= UAP_FRN_BIT(eI034_FRN_I034_010) | UAP_FRN_BIT(eI034_FRN_I034_000) |
+                              UAP_FRN_BIT(eI034_FRN_I034_030) | UAP_FRN_BIT(eI034_FRN_I034_020) |
+                              UAP_FRN_BIT(eI034_FRN_I034_041);
+        return;
+    }
+
+    expand_I034_050(&cold->I034_050, &rec->I034_050);
+    expand_I034_060(&cold->I034_060, &rec->I034_060);
+    rec->I034_070.REP = cold->REP;
+    rec->I034_070.RAW = cold->RAW;
+    set_I034_100_RHO_START_raw(&rec->I034_100, cold->RHO_START);
+    set_I034_100_RHO_END_raw(&rec->I034_100, cold->RHO_END);
+    set_I034_100_THETA_START_raw(&rec->I034_100, cold->THETA_START);
+    set_I034_100_THETA_END_raw(&rec->I034_100, cold->THETA_END);
+    rec->I034_110.TYP = (eI034_110_TYP)cold->TYP;
+    rec->I034_120.HEIGHT = cold->HEIGHT;
+    set_I034_120_LATWGS84_raw(&rec->I034_120, cold->LATWGS84);
+    set_I034_120_LONWGS84_raw(&rec->I034_120, cold->LONWGS84);
+    set_I034_090_RANGEERR_raw(&rec->I034_090, cold->RANGEERR);
+    set_I034_090_AZERR_raw(&rec->I034_090, cold->AZERR);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file I034_Edition.c
+ * @brief Editions of Category 034 and their selection per data source
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include <string.h>
+
+#include <Common/config.h>
+#include <Categories/I034/I034_Edition.h>
+
+ASTERIX_STATIC_ASSERT((I034_MAX_SOURCES & (I034_MAX_SOURCES - 1U)) == 0U, I034_MAX_SOURCES_pow2);
+
+/* Bits FIRST to LAST of a value mask */
+#define I034_VALUES(FIRST, LAST)    ((((u32)1U << ((LAST) + 1U)) - 1U) & ~(((u32)1U << (FIRST)) - 1U))
+
+const I034_Edition I034_EDITIONS[eI034_Edition_COUNT] = {
+    {
+        1U, 27U, &I034_UAP,
+        I034_VALUES(eI034_000_MSG_TYPE_NORTH_MARKER, eI034_000_MSG_TYPE_JAMMING_STROBE),
+        I034_VALUES(eI034_070_TYP_MISSES, eI034_070_TYP_FIL_PSR_ENHS_MS),
+    },
+    {
+        1U, 28U, &I034_UAP,
+        I034_VALUES(eI034_000_MSG_TYPE_NORTH_MARKER, eI034_000_MSG_TYPE_SOLAR_STORM),
+        I034_VALUES(eI034_070_TYP_MISSES, eI034_070_TYP_MS_FRUIT),
+    },
+    {
+        1U, 29U, &I034_UAP,
+        I034_VALUES(eI034_000_MSG_TYPE_NORTH_MARKER, eI034_000_MSG_TYPE_MS_JAMMING_STROBE),
+        I034_VALUES(eI034_070_TYP_MISSES, eI034_070_TYP_MS_FRUIT),
+    },
+};
+
+/* Registered sources: open addressing on SAC/SIC, linear probing */
+typedef struct
+{
+    u16 key;
+    u8  used;
+    u8  edition;
+} I034_Source;
+
+static I034_Source I034_sources[I034_MAX_SOURCES];
+
+static size_t I034_source_slot(u16 key)
+{
+    return (size_t)(((u32)key * 0x9E3779B1U) >> 16U) & (I034_MAX_SOURCES - 1U);
+}
+
+/* ============================== EXTRA FUNCS ============================== */
+
+const I034_Edition *register_I034_source(u8 sac, u8 sic, eI034_Edition edition)
+{
+    u16 key = (u16)(((u16)sac << 8U) | sic);
+    size_t slot = I034_source_slot(key);
+    size_t i = 0U;
+
+    if ((unsigned)edition >= (unsigned)eI034_Edition_COUNT)
+        return NULL;
+
+    for (i = 0U; i < I034_MAX_SOURCES; i++)
+    {
+        I034_Source *src = &I034_sources[(slot + i) & (I034_MAX_SOURCES - 1U)];
+
+        if (!src->used || (src->key == key))
+        {
+            src->key     = key;
+            src->used    = 1U;
+            src->edition = (u8)edition;
+            return &I034_EDITIONS[edition];
+        }
+    }
+    return NULL;
+}
+
+const I034_Edition *edition_I034_source(u8 sac, u8 sic)
+{
+    u16 key = (u16)(((u16)sac << 8U) | sic);
+    size_t slot = I034_source_slot(key);
+    size_t i = 0U;
+
+    for (i = 0U; i < I034_MAX_SOURCES; i++)
+    {
+        const I034_Source *src = &I034_sources[(slot + i) & (I034_MAX_SOURCES - 1U)];
+
+        if (!src->used)
+            break;
+        if (src->key == key)
+            return &I034_EDITIONS[src->edition];
+    }
+    return &I034_EDITIONS[I034_EDITION_DEFAULT];
+}
+
+void clear_I034_sources(void)
+{
+    memset(I034_sources, 0, sizeof(I034_sources));
+}
+
+eAsterixStatus validate_I034(const I034_Edition *edition, const I034 *item)
+{
+    if (I034_FSPEC_GET(&item->FSPEC, I034_000))
+    {
+        u32 value = (u32)item->I034_000.MSGTYPE;
+
+        if ((value >= 32U) || !((edition->msgtype_valid >> value) & 1U))
+            return eAsterixStatus_ERR_VALUE;
+    }
+
+    if (I034_FSPEC_GET(&item->FSPEC, I034_070))
+    {
+        I034_070_Iter iter;
+        I034_070_COUNTER counter;
+
+        /* TYP is 5 bits wide: always within the mask */
+        iter_init_I034_070(&iter, &item->I034_070);
+        while (iter_next_I034_070(&iter, &counter))
+        {
+            if (!((edition->typ_valid >> (u32)counter.TYP) & 1U))
+                return eAsterixStatus_ERR_VALUE;
+        }
+    }
+    return eAsterixStatus_OK;
+}
@@ -9,25 +9,43 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_RE.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_RE
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_RE(BitStream *bs, const I034_RE *item)
 {
-    // TODO: User defined implementation
-
-    return;
+    explicit_encode(bs, item->LEN, item->DATA);
 }
 
 void decode_I034_RE(BitStream *bs, I034_RE *item)
 {
-    // TODO: User defined implementation
+    item->DATA = explicit_decode(bs, &item->LEN);
+}
+
+size_t length_I034_RE(BitStream *bs)
+{
+    return explicit_length(bs);
+}
 
-    return;
+size_t encoded_size_I034_RE(const I034_RE *item)
+{
+    return item->LEN;
+}
+
+void skip_I034_RE(BitStream *bs)
+{
+    size_t len = length_I034_RE(bs);
+
+    if (len != 0U)
+        bs_skip(bs, len);
 }
 
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_RE(const I034_RE *item)
 {
     printf("I034/RE - Reserved Expansion Field\n");
@@ -37,5 +55,13 @@ void print_I034_RE(const I034_RE *item)
         return;
     }
 
-    // TODO: User defined implementation
+    explicit_print(item->LEN, item->DATA);
 }
+#endif /* I034_WITH_PRINT */
+
+eAsterixStatus decode_I034_RE_plugin(const I034_RE *item, void *out)
+{
+    return explicit_decode_plugin(34U, eExplicitField_RE, item->DATA, EXPLICIT_DATA_LEN(item->LEN), out);
+}
+
+#endif /* I034_WITH_RE */
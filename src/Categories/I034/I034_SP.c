@@ -9,33 +9,59 @@
 #include <stdio.h>
 
 #include <Categories/I034/I034_SP.h>
+#include <Categories/I034/I034_config.h>
+
+#if I034_WITH_SP
 
 /* =============================== DE/ENCODE =============================== */
 
 void encode_I034_SP(BitStream *bs, const I034_SP *item)
 {
-    // TODO: User defined implementation
-
-    return;
+    explicit_encode(bs, item->LEN, item->DATA);
 }
 
 void decode_I034_SP(BitStream *bs, I034_SP *item)
 {
-    // TODO: User defined implementation
+    item->DATA = explicit_decode(bs, &item->LEN);
+}
+
+size_t length_I034_SP(BitStream *bs)
+{
+    return explicit_length(bs);
+}
 
-    return;
+size_t encoded_size_I034_SP(const I034_SP *item)
+{
+    return item->LEN;
+}
+
+void skip_I034_SP(BitStream *bs)
+{
+    size_t len = length_I034_SP(bs);
+
+    if (len != 0U)
+        bs_skip(bs, len);
 }
 
 /* ============================== EXTRA FUNCS ============================== */
 
+#if I034_WITH_PRINT
 void print_I034_SP(const I034_SP *item)
 {
-    printf("I034/SP - Reserved Expansion Field\n");
+    printf("I034/SP - Special Purpose Field\n");
     if (!item)
     {
         printf("I034/SP: <null>\n");
         return;
     }
 
-    // TODO: User defined implementation
+    explicit_print(item->LEN, item->DATA);
 }
+#endif /* I034_WITH_PRINT */
+
+eAsterixStatus decode_I034_SP_plugin(const I034_SP *item, void *out)
+{
+    return explicit_decode_plugin(34U, eExplicitField_SP, item->DATA, EXPLICIT_DATA_LEN(item->LEN), out);
+}
+
+#endif /* I034_WITH_SP */
@@ -0,0 +1,55 @@
+/**
+ * @file Registry.c
+ * @brief Registry of the category codecs, indexed by the CAT octet
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ */
+#include <Categories/Registry.h>
+#include <Categories/I034/I034.h>
+
+/* Codecs by CAT octet, with the categories of the library registered */
+static const AsterixCategory * asterix_categories[ASTERIX_REGISTRY_SIZE] =
+{
+    [34U] = &I034_CATEGORY,
+};
+
+/* =============================== DE/ENCODE =============================== */
+
+size_t asterix_decode_block(BitStream *bs, void *storage, size_t storage_size,
+                            const AsterixCategory **category)
+{
+    const AsterixCategory *codecs = NULL;
+
+    *category = NULL;
+    if (bs_validate_block(bs) != eAsterixStatus_OK)
+        return 0U;
+
+    codecs = asterix_categories[bs_deserialize_cat(bs)];
+    if ((codecs == NULL) || (codecs->decode == NULL))
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_CAT);
+        return 0U;
+    }
+
+    *category = codecs;
+    return codecs->decode(bs, storage, storage_size / codecs->record_size);
+}
+
+/* ============================== EXTRA FUNCS ============================== */
+
+void asterix_register_category(const AsterixCategory *category)
+{
+    asterix_categories[category->cat] = category;
+}
+
+void asterix_unregister_category(u8 cat)
+{
+    asterix_categories[cat] = NULL;
+}
+
+const AsterixCategory *asterix_category(u8 cat)
+{
+    return asterix_categories[cat];
+}
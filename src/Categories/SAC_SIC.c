@@ -14,14 +14,20 @@
 
 void encode_SAC_SIC(BitStream *bs, const SAC_SIC *item)
 {
-    bs_serialize_u32(bs, item->SAC, 8U);
-    bs_serialize_u32(bs, item->SIC, 8U);
+    bs_serialize_aligned_u8(bs, item->SAC);
+    bs_serialize_aligned_u8(bs, item->SIC);
 }
 
 void decode_SAC_SIC(BitStream *bs, SAC_SIC *item)
 {
-    item->SAC = bs_deserialize_u32(bs, 8U);
-    item->SIC = bs_deserialize_u32(bs, 8U);
+    u8 tmp[2U];
+    read_SAC_SIC(bs_read_ptr(bs, tmp, 2U), item);
+}
+
+void read_SAC_SIC(const u8 *raw, SAC_SIC *item)
+{
+    item->SAC = raw[0U];
+    item->SIC = raw[1U];
 }
 
 /* ============================== EXTRA FUNCS ============================== */
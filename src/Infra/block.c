@@ -0,0 +1,71 @@
+/**
+ * @file block.c
+ * @brief Iteration over the data blocks of a datagram and the records of a block
+ */
+#include <Infra/block.h>
+
+/* ============================== EXTRA FUNCS ============================== */
+
+void block_iter_init(AsterixBlockIter *it, const u8 *data, size_t size)
+{
+    it->data   = data;
+    it->size   = size;
+    it->pos    = 0U;
+    it->status = eAsterixStatus_OK;
+}
+
+eBoolean block_iter_next(AsterixBlockIter *it, AsterixBlock *block)
+{
+    const u8 *p = NULL;
+    u16 len = 0U;
+
+    if ((it->status != eAsterixStatus_OK) || (it->pos >= it->size))
+        return eBoolean_FALSE;
+
+    if ((it->size - it->pos) < ASTERIX_BLOCK_HEADER_LEN)
+    {
+        it->status = eAsterixStatus_ERR_LEN;
+        return eBoolean_FALSE;
+    }
+    p = &it->data[it->pos];
+    len = (u16)(((u16)p[1U] << 8U) | (u16)p[2U]);
+    if ((len < ASTERIX_BLOCK_HEADER_LEN) || (len > (it->size - it->pos)))
+    {
+        it->status = eAsterixStatus_ERR_LEN;
+        return eBoolean_FALSE;
+    }
+
+    block->data   = p;
+    block->offset = it->pos;
+    block->cat    = p[0U];
+    block->len    = len;
+    it->pos += len;
+    return eBoolean_TRUE;
+}
+
+eAsterixStatus record_iter_init(AsterixRecordIter *it, const AsterixBlock *block, const Uap *uap)
+{
+    /* The stream is only read: the octets are never written through it */
+    bs_init(&it->bs, (u8 *)block->data, block->len);
+    it->uap = uap;
+    return bs_validate_block(&it->bs);
+}
+
+eBoolean record_iter_next(AsterixRecordIter *it, AsterixRecord *record)
+{
+    BitStream *bs = &it->bs;
+    size_t start = bs->byte_pos;
+    u64 present = 0U;
+
+    if ((bs_status(bs) != eAsterixStatus_OK) || (start >= bs->limit))
+        return eBoolean_FALSE;
+
+    if ((uap_decode_fspec(bs, it->uap, &present) != eAsterixStatus_OK)
+        || (uap_skip_items(bs, it->uap, present) != eAsterixStatus_OK))
+        return eBoolean_FALSE;
+
+    record->data   = &bs->buffer[start];
+    record->offset = start;
+    record->len    = bs->byte_pos - start;
+    return eBoolean_TRUE;
+}
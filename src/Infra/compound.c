@@ -0,0 +1,158 @@
+/**
+ * @file compound.c
+ * @brief Generic codec of compound data items
+ */
+#include <Infra/compound.h>
+
+/* Total length of the subfields present in a primary subfield read from the
+ * wire: a bit that is a spare or beyond the subfields described has no
+ * length, so it is rejected rather than ignored, which would misalign the
+ * rest of the record */
+static size_t compound_decoded_len(BitStream *bs, const Compound *compound, u64 present)
+{
+    size_t len = 0U;
+
+    while (present != 0U)
+    {
+        size_t idx = uap_ctz64(present);
+
+        present &= present - 1U;
+        if ((idx >= compound->n_subfields) || (compound->subfields[idx].len == 0U))
+        {
+            bs_set_error(bs, eAsterixStatus_ERR_FSPEC);
+            return 0U;
+        }
+        len += compound->subfields[idx].len;
+    }
+    return len;
+}
+
+/* Total length of the present subfields */
+static size_t compound_subfields_len(const Compound *compound, u64 present)
+{
+    size_t len = 0U;
+
+    while (present != 0U)
+    {
+        len += compound->subfields[uap_ctz64(present)].len;
+        present &= present - 1U;
+    }
+    return len;
+}
+
+static ePresenceFlag *compound_flag(const CompoundSubfield *sf, void *item)
+{
+    return (ePresenceFlag *)((u8 *)item + sf->flag_offset);
+}
+
+/* =============================== DE/ENCODE =============================== */
+
+/* Presence mask of the subfields flagged present in the item structure */
+static u64 compound_presence(const Compound *compound, const void *item)
+{
+    const u8 *base = (const u8 *)item;
+    u64 present = 0U;
+    size_t i = 0U;
+
+    for (i = 0U; i < compound->n_subfields; i++)
+    {
+        const CompoundSubfield *sf = &compound->subfields[i];
+
+        if ((sf->len != 0U) && (*(const ePresenceFlag *)(base + sf->flag_offset) == ePresenceFlag_PRESENT))
+            present |= (u64)1U << i;
+    }
+    return present;
+}
+
+void compound_encode(BitStream *bs, const Compound *compound, const void *item)
+{
+    const u8 *base = (const u8 *)item;
+    u64 present = compound_presence(compound, item);
+
+    if (!bs_require(bs, uap_fspec_octets(present) + compound_subfields_len(compound, present)))
+        return;
+    uap_write_presence(bs, present);
+
+    while (present != 0U)
+    {
+        const CompoundSubfield *sf = &compound->subfields[uap_ctz64(present)];
+        u8 tmp[COMPOUND_MAX_SUBFIELD_LEN];
+        u8 *p = bs_write_ptr(bs, tmp, sf->len);
+
+        present &= present - 1U;
+        sf->encode(p, base + sf->offset);
+        bs_write_done(bs, p, tmp, sf->len);
+    }
+}
+
+void compound_decode(BitStream *bs, const Compound *compound, void *item)
+{
+    u8 *base = (u8 *)item;
+    u64 present = 0U;
+    size_t n_octets = uap_peek_presence(bs, &present);
+    size_t len = 0U;
+    const u8 *data = NULL;
+    size_t i = 0U;
+
+    if (n_octets == 0U)
+        return;
+    len = compound_decoded_len(bs, compound, present);
+    if (bs_status(bs) != eAsterixStatus_OK)
+        return;
+    bs->byte_pos += n_octets;
+    if (!bs_require(bs, len))
+        return;
+
+    for (i = 0U; i < compound->n_subfields; i++)
+    {
+        const CompoundSubfield *sf = &compound->subfields[i];
+
+        if (sf->len != 0U)
+            *compound_flag(sf, item) = ((present >> i) & 1U) ? ePresenceFlag_PRESENT : ePresenceFlag_ABSENT;
+    }
+    if (compound->fx_offset != COMPOUND_NO_FIELD)
+        *(ePresenceFlag *)(base + compound->fx_offset) = (n_octets > 1U) ? ePresenceFlag_PRESENT : ePresenceFlag_ABSENT;
+
+    /* The subfields are unpacked in place, unless they straddle two segments */
+    data = bs_fast_ptr(bs, bs->byte_pos, len);
+    if (data != NULL)
+    {
+        while (present != 0U)
+        {
+            const CompoundSubfield *sf = &compound->subfields[uap_ctz64(present)];
+
+            present &= present - 1U;
+            sf->decode(data, base + sf->offset);
+            data += sf->len;
+        }
+        bs->byte_pos += len;
+        return;
+    }
+    while (present != 0U)
+    {
+        const CompoundSubfield *sf = &compound->subfields[uap_ctz64(present)];
+        u8 tmp[COMPOUND_MAX_SUBFIELD_LEN];
+
+        present &= present - 1U;
+        sf->decode(bs_read_ptr(bs, tmp, sf->len), base + sf->offset);
+    }
+}
+
+size_t compound_length(BitStream *bs, const Compound *compound)
+{
+    u64 present = 0U;
+    size_t n_octets = uap_peek_presence(bs, &present);
+    size_t len = 0U;
+
+    if (n_octets == 0U)
+        return 0U;
+    len = compound_decoded_len(bs, compound, present);
+    return (bs_status(bs) == eAsterixStatus_OK) ? (n_octets + len) : 0U;
+}
+
+size_t compound_encoded_size(const Compound *compound, const void *item)
+{
+    u64 present = compound_presence(compound, item);
+
+    return uap_fspec_octets(present) + compound_subfields_len(compound, present);
+}
@@ -0,0 +1,134 @@
+/**
+ * @file cpu_dispatch.c
+ * @brief Scalar reference kernels and selection of the kernel level
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu_kernels.h"
+
+/* ============================ SCALAR KERNELS ============================ */
+
+size_t cpu_fx_scan_scalar(const u8 *src, size_t n)
+{
+    size_t i = 0U;
+
+    for (i = 0U; i < n; i++) {
+        if ((src[i] & 0x01U) == 0U) {
+            return i + 1U;
+        }
+    }
+    return 0U;
+}
+
+void cpu_be16_unpack_scalar(u16 *dst, const u8 *src, size_t n)
+{
+    size_t i = 0U;
+
+    for (i = 0U; i < n; i++) {
+        dst[i] = (u16)(((u16)src[2U * i] << 8U) | src[(2U * i) + 1U]);
+    }
+}
+
+#ifndef ASTERIX_NO_FLOAT
+void cpu_raw_to_float_scalar(float *dst, const s32 *src, size_t n, double lsb)
+{
+    size_t i = 0U;
+
+    for (i = 0U; i < n; i++) {
+        dst[i] = (float)((double)src[i] * lsb);
+    }
+}
+#endif /* ASTERIX_NO_FLOAT */
+
+const AsterixKernels cpu_kernels_scalar = {
+    eAsterixCpuLevel_SCALAR,
+    cpu_fx_scan_scalar,
+    cpu_be16_unpack_scalar,
+#ifndef ASTERIX_NO_FLOAT
+    cpu_raw_to_float_scalar,
+#endif
+};
+
+/* =============================== DISPATCH =============================== */
+
+const AsterixKernels *asterix_kernels = &cpu_kernels_scalar;
+
+static const char *const cpu_level_names[] = { "scalar", "sse2", "avx2", "neon" };
+
+eAsterixCpuLevel asterix_cpu_detect(void)
+{
+#if ASTERIX_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return eAsterixCpuLevel_AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return eAsterixCpuLevel_SSE2;
+#elif ASTERIX_NEON_KERNELS
+    /* Advanced SIMD is mandatory on AArch64 */
+    return eAsterixCpuLevel_NEON;
+#endif
+    return eAsterixCpuLevel_SCALAR;
+}
+
+eAsterixCpuLevel asterix_cpu_level(void)
+{
+    return asterix_kernels->level;
+}
+
+eBoolean asterix_cpu_set_level(eAsterixCpuLevel level)
+{
+    const AsterixKernels *kernels = NULL;
+
+    switch (level)
+    {
+    case eAsterixCpuLevel_SCALAR:
+        kernels = &cpu_kernels_scalar;
+        break;
+#if ASTERIX_X86_KERNELS
+    case eAsterixCpuLevel_SSE2:
+        kernels = (asterix_cpu_detect() >= eAsterixCpuLevel_SSE2) ? &cpu_kernels_sse2 : NULL;
+        break;
+    case eAsterixCpuLevel_AVX2:
+        kernels = (asterix_cpu_detect() == eAsterixCpuLevel_AVX2) ? &cpu_kernels_avx2 : NULL;
+        break;
+#endif
+#if ASTERIX_NEON_KERNELS
+    case eAsterixCpuLevel_NEON:
+        kernels = (asterix_cpu_detect() == eAsterixCpuLevel_NEON) ? &cpu_kernels_neon : NULL;
+        break;
+#endif
+    default:
+        break;
+    }
+
+    if (kernels == NULL)
+        return eBoolean_FALSE;
+    asterix_kernels = kernels;
+    return eBoolean_TRUE;
+}
+
+const char *asterix_cpu_level_name(eAsterixCpuLevel level)
+{
+    if ((size_t)level >= (sizeof(cpu_level_names) / sizeof(cpu_level_names[0])))
+        return "unknown";
+    return cpu_level_names[level];
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+/* Pick the kernels once, when the library is loaded */
+__attribute__((constructor)) static void cpu_dispatch_init(void)
+{
+    const char *forced = getenv("ASTERIX_CPU_LEVEL");
+    size_t i = 0U;
+
+    (void)asterix_cpu_set_level(asterix_cpu_detect());
+    if (forced == NULL)
+        return;
+    for (i = 0U; i < (sizeof(cpu_level_names) / sizeof(cpu_level_names[0])); i++) {
+        if (strcmp(forced, cpu_level_names[i]) == 0) {
+            (void)asterix_cpu_set_level((eAsterixCpuLevel)i);
+        }
+    }
+}
+#endif
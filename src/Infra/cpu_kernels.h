@@ -0,0 +1,40 @@
+/**
+ * @file cpu_kernels.h
+ * @brief Kernel tables of every instruction set level (internal to the library)
+ */
+
+#ifndef CPU_KERNELS_H
+#define CPU_KERNELS_H
+
+#include <Infra/cpu_dispatch.h>
+
+#if !defined(ASTERIX_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+    #define ASTERIX_X86_KERNELS     1
+#else
+    #define ASTERIX_X86_KERNELS     0
+#endif
+
+#if !defined(ASTERIX_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+    #define ASTERIX_NEON_KERNELS    1
+#else
+    #define ASTERIX_NEON_KERNELS    0
+#endif
+
+/* Scalar kernels, also used by the vector ones for the tails */
+size_t cpu_fx_scan_scalar(const u8 *src, size_t n);
+void cpu_be16_unpack_scalar(u16 *dst, const u8 *src, size_t n);
+#ifndef ASTERIX_NO_FLOAT
+void cpu_raw_to_float_scalar(float *dst, const s32 *src, size_t n, double lsb);
+#endif /* ASTERIX_NO_FLOAT */
+
+extern const AsterixKernels cpu_kernels_scalar;
+#if ASTERIX_X86_KERNELS
+extern const AsterixKernels cpu_kernels_sse2;
+extern const AsterixKernels cpu_kernels_avx2;
+#endif
+#if ASTERIX_NEON_KERNELS
+extern const AsterixKernels cpu_kernels_neon;
+#endif
+
+#endif /* CPU_KERNELS_H */
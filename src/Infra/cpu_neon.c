@@ -0,0 +1,70 @@
+/**
+ * @file cpu_neon.c
+ * @brief AArch64 Advanced SIMD kernels (see Infra/cpu_dispatch.h)
+ */
+#include "cpu_kernels.h"
+
+#if ASTERIX_NEON_KERNELS
+
+#include <arm_neon.h>
+
+static size_t cpu_fx_scan_neon(const u8 *src, size_t n)
+{
+    const uint8x16_t one = vdupq_n_u8(1U);
+    size_t i = 0U;
+    size_t tail = 0U;
+
+    for (i = 0U; (i + 16U) <= n; i += 16U) {
+        uint8x16_t v = vld1q_u8(&src[i]);
+        /* 0xFF in the lanes whose FX bit (LSB) is clear */
+        uint8x16_t end = vceqq_u8(vandq_u8(v, one), vdupq_n_u8(0U));
+        if (vmaxvq_u8(end) != 0U) {
+            return i + cpu_fx_scan_scalar(&src[i], 16U);
+        }
+    }
+    tail = cpu_fx_scan_scalar(&src[i], n - i);
+    return (tail == 0U) ? 0U : (i + tail);
+}
+
+static void cpu_be16_unpack_neon(u16 *dst, const u8 *src, size_t n)
+{
+    size_t i = 0U;
+
+    for (i = 0U; (i + 8U) <= n; i += 8U) {
+        vst1q_u16(&dst[i], vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(&src[2U * i]))));
+    }
+    cpu_be16_unpack_scalar(&dst[i], &src[2U * i], n - i);
+}
+
+#ifndef ASTERIX_NO_FLOAT
+static void cpu_raw_to_float_neon(float *dst, const s32 *src, size_t n, double lsb)
+{
+    const float64x2_t scale = vdupq_n_f64(lsb);
+    size_t i = 0U;
+
+    /* Same rounding as the scalar kernel: exact product in double, then float */
+    for (i = 0U; (i + 4U) <= n; i += 4U) {
+        int32x4_t raw = vld1q_s32(&src[i]);
+        float64x2_t lo = vmulq_f64(vcvtq_f64_s64(vmovl_s32(vget_low_s32(raw))), scale);
+        float64x2_t hi = vmulq_f64(vcvtq_f64_s64(vmovl_s32(vget_high_s32(raw))), scale);
+        vst1q_f32(&dst[i], vcombine_f32(vcvt_f32_f64(lo), vcvt_f32_f64(hi)));
+    }
+    cpu_raw_to_float_scalar(&dst[i], &src[i], n - i, lsb);
+}
+#endif /* ASTERIX_NO_FLOAT */
+
+const AsterixKernels cpu_kernels_neon = {
+    eAsterixCpuLevel_NEON,
+    cpu_fx_scan_neon,
+    cpu_be16_unpack_neon,
+#ifndef ASTERIX_NO_FLOAT
+    cpu_raw_to_float_neon,
+#endif
+};
+
+#else
+
+/* ISO C requires at least one declaration per translation unit */
+typedef int cpu_neon_unused;
+
+#endif /* ASTERIX_NEON_KERNELS */
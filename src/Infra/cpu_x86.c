@@ -0,0 +1,138 @@
+/**
+ * @file cpu_x86.c
+ * @brief SSE2 and AVX2 kernels (see Infra/cpu_dispatch.h)
+ *
+ * Every function carries its own target attribute, so this file is built with
+ * the same flags as the rest of the library and is only ever run after
+ * asterix_cpu_detect() has checked the host.
+ */
+#include "cpu_kernels.h"
+
+#if ASTERIX_X86_KERNELS
+
+#include <immintrin.h>
+
+#define CPU_SSE2    __attribute__((target("sse2")))
+#define CPU_AVX2    __attribute__((target("avx2")))
+
+/* ================================= SSE2 ================================= */
+
+CPU_SSE2 static size_t cpu_fx_scan_sse2(const u8 *src, size_t n)
+{
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0U;
+    size_t tail = 0U;
+
+    for (i = 0U; (i + 16U) <= n; i += 16U) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)&src[i]);
+        /* Octets whose FX bit (LSB) is clear end the chain */
+        unsigned int end = (unsigned int)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_and_si128(v, one), _mm_setzero_si128()));
+        if (end != 0U) {
+            return i + (size_t)__builtin_ctz(end) + 1U;
+        }
+    }
+    tail = cpu_fx_scan_scalar(&src[i], n - i);
+    return (tail == 0U) ? 0U : (i + tail);
+}
+
+CPU_SSE2 static void cpu_be16_unpack_sse2(u16 *dst, const u8 *src, size_t n)
+{
+    size_t i = 0U;
+
+    for (i = 0U; (i + 8U) <= n; i += 8U) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(const void *)&src[2U * i]);
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128((__m128i *)(void *)&dst[i], v);
+    }
+    cpu_be16_unpack_scalar(&dst[i], &src[2U * i], n - i);
+}
+
+#ifndef ASTERIX_NO_FLOAT
+CPU_SSE2 static void cpu_raw_to_float_sse2(float *dst, const s32 *src, size_t n, double lsb)
+{
+    const __m128d scale = _mm_set1_pd(lsb);
+    size_t i = 0U;
+
+    /* Same rounding as the scalar kernel: exact product in double, then float */
+    for (i = 0U; (i + 4U) <= n; i += 4U) {
+        __m128i raw = _mm_loadu_si128((const __m128i *)(const void *)&src[i]);
+        __m128 lo = _mm_cvtpd_ps(_mm_mul_pd(_mm_cvtepi32_pd(raw), scale));
+        __m128 hi = _mm_cvtpd_ps(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(raw, 8)), scale));
+        _mm_storeu_ps(&dst[i], _mm_movelh_ps(lo, hi));
+    }
+    cpu_raw_to_float_scalar(&dst[i], &src[i], n - i, lsb);
+}
+#endif /* ASTERIX_NO_FLOAT */
+
+const AsterixKernels cpu_kernels_sse2 = {
+    eAsterixCpuLevel_SSE2,
+    cpu_fx_scan_sse2,
+    cpu_be16_unpack_sse2,
+#ifndef ASTERIX_NO_FLOAT
+    cpu_raw_to_float_sse2,
+#endif
+};
+
+/* ================================= AVX2 ================================= */
+
+CPU_AVX2 static size_t cpu_fx_scan_avx2(const u8 *src, size_t n)
+{
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0U;
+
+    for (i = 0U; (i + 32U) <= n; i += 32U) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)&src[i]);
+        unsigned int end = (unsigned int)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_and_si256(v, one), _mm256_setzero_si256()));
+        if (end != 0U) {
+            return i + (size_t)__builtin_ctz(end) + 1U;
+        }
+    }
+    if (i == n)
+        return 0U;
+    n = cpu_fx_scan_sse2(&src[i], n - i);
+    return (n == 0U) ? 0U : (i + n);
+}
+
+CPU_AVX2 static void cpu_be16_unpack_avx2(u16 *dst, const u8 *src, size_t n)
+{
+    size_t i = 0U;
+
+    for (i = 0U; (i + 16U) <= n; i += 16U) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)&src[2U * i]);
+        v = _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8));
+        _mm256_storeu_si256((__m256i *)(void *)&dst[i], v);
+    }
+    cpu_be16_unpack_sse2(&dst[i], &src[2U * i], n - i);
+}
+
+#ifndef ASTERIX_NO_FLOAT
+CPU_AVX2 static void cpu_raw_to_float_avx2(float *dst, const s32 *src, size_t n, double lsb)
+{
+    const __m256d scale = _mm256_set1_pd(lsb);
+    size_t i = 0U;
+
+    for (i = 0U; (i + 4U) <= n; i += 4U) {
+        __m128i raw = _mm_loadu_si128((const __m128i *)(const void *)&src[i]);
+        _mm_storeu_ps(&dst[i], _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_cvtepi32_pd(raw), scale)));
+    }
+    cpu_raw_to_float_scalar(&dst[i], &src[i], n - i, lsb);
+}
+#endif /* ASTERIX_NO_FLOAT */
+
+const AsterixKernels cpu_kernels_avx2 = {
+    eAsterixCpuLevel_AVX2,
+    cpu_fx_scan_avx2,
+    cpu_be16_unpack_avx2,
+#ifndef ASTERIX_NO_FLOAT
+    cpu_raw_to_float_avx2,
+#endif
+};
+
+#else
+
+/* ISO C requires at least one declaration per translation unit */
+typedef int cpu_x86_unused;
+
+#endif /* ASTERIX_X86_KERNELS */
@@ -0,0 +1,105 @@
+/**
+ * @file explicit.c
+ * @brief Explicit-length data fields (Reserved Expansion and Special Purpose)
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include <Infra/explicit.h>
+
+/* Plugins by category and field */
+static ExplicitDecodeFn explicit_plugins[256U][eExplicitField_COUNT];
+
+/* =============================== DE/ENCODE =============================== */
+
+void explicit_encode(BitStream *bs, u8 len, const u8 *data)
+{
+    u8 tmp[255U];
+    u8 *p = NULL;
+    size_t n_bytes = EXPLICIT_DATA_LEN(len);
+
+    if (len == 0U)
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_LEN);
+        return;
+    }
+    if (!bs_require(bs, len))
+        return;
+
+    /* The payload is opaque: copied through as is */
+    bs_serialize_aligned_u8(bs, len);
+    p = bs_write_ptr(bs, tmp, n_bytes);
+    if (n_bytes != 0U)
+        memcpy(p, data, n_bytes);
+    bs_write_done(bs, p, tmp, n_bytes);
+}
+
+const u8 *explicit_decode(BitStream *bs, u8 *len)
+{
+    size_t n_bytes = explicit_length(bs);
+
+    *len = 0U;
+    if ((n_bytes == 0U) || !bs_require(bs, n_bytes))
+        return NULL;
+
+    *len = bs_deserialize_aligned_u8(bs);
+    if (n_bytes == 1U)
+        return NULL;
+    return bs_ref_ptr(bs, n_bytes - 1U);
+}
+
+size_t explicit_length(BitStream *bs)
+{
+    u8 len = 0U;
+
+    if (!bs_require(bs, 1U))
+        return 0U;
+
+    /* The first octet holds the length of the whole field */
+    len = bs_peek_aligned_u8(bs, 0U);
+    if (len == 0U)
+        bs_set_error(bs, eAsterixStatus_ERR_LEN);
+    return len;
+}
+
+/* ============================== EXTRA FUNCS ============================== */
+
+eAsterixStatus explicit_register(u8 cat, eExplicitField field, ExplicitDecodeFn decode)
+{
+    if ((unsigned)field >= (unsigned)eExplicitField_COUNT)
+        return eAsterixStatus_ERR_PLUGIN;
+
+    explicit_plugins[cat][field] = decode;
+    return eAsterixStatus_OK;
+}
+
+ExplicitDecodeFn explicit_plugin(u8 cat, eExplicitField field)
+{
+    if ((unsigned)field >= (unsigned)eExplicitField_COUNT)
+        return NULL;
+    return explicit_plugins[cat][field];
+}
+
+eAsterixStatus explicit_decode_plugin(u8 cat, eExplicitField field, const u8 *data, size_t len, void *out)
+{
+    ExplicitDecodeFn decode = explicit_plugin(cat, field);
+
+    if (decode == NULL)
+        return eAsterixStatus_ERR_PLUGIN;
+    return decode(data, len, out);
+}
+
+void explicit_print(u8 len, const u8 *data)
+{
+    size_t n_bytes = EXPLICIT_DATA_LEN(len);
+    size_t i = 0U;
+
+    printf("- LEN = %u\n", len);
+    if ((data == NULL) || (n_bytes == 0U))
+        return;
+
+    printf("- DATA =");
+    for (i = 0U; i < n_bytes; i++)
+        printf(" %02X", data[i]);
+    printf("\n");
+}
@@ -0,0 +1,170 @@
+/**
+ * @file field.c
+ * @brief Field metadata of the data items and field access by path
+ */
+#include <string.h>
+
+#include <Infra/field.h>
+
+/* Length of the next path component (up to '.', '[' or the end) */
+static size_t field_token(const char *path)
+{
+    size_t len = 0U;
+
+    while ((path[len] != '\0') && (path[len] != '.') && (path[len] != '['))
+        len++;
+    return len;
+}
+
+/* Whether the first len characters of token are name */
+static eBoolean field_match(const char *name, const char *token, size_t len)
+{
+    return ((name != NULL) && (strncmp(name, token, len) == 0) && (name[len] == '\0')) ? eBoolean_TRUE : eBoolean_FALSE;
+}
+
+/* Parse "[n]" at path into index, returning the characters read (0 on error) */
+static size_t field_index(const char *path, u16 *index)
+{
+    size_t i = 1U;
+    u32 value = 0U;
+
+    if ((path[0] != '[') || (path[1] < '0') || (path[1] > '9'))
+        return 0U;
+    while ((path[i] >= '0') && (path[i] <= '9'))
+    {
+        value = (value * 10U) + (u32)(path[i] - '0');
+        if (value > 0xFFFFU)
+            return 0U;
+        i++;
+    }
+    if (path[i] != ']')
+        return 0U;
+    *index = (u16)value;
+    return i + 1U;
+}
+
+/* ============================== EXTRA FUNCS ============================== */
+
+eAsterixStatus field_compile(FieldAccessor *acc, const FieldItem *const *items,
+                             size_t n_items, const char *path)
+{
+    const FieldItem *item = NULL;
+    const FieldGroup *group = NULL;
+    const FieldMeta *field = NULL;
+    size_t len = field_token(path);
+    size_t first = 0U;
+    size_t i = 0U;
+    u16 index = 0U;
+
+    memset(acc, 0, sizeof(*acc));
+
+    // ITEM, with its repetition index if repetitive
+    for (i = 0U; (i < n_items) && (item == NULL); i++)
+    {
+        if ((items[i] != NULL) && field_match(items[i]->name, path, len))
+            item = items[i];
+    }
+    if (item == NULL)
+        return eAsterixStatus_ERR_FIELD;
+    acc->frn = (u8)i;    /* index + 1, past the match */
+    path += len;
+    if (item->kind == (u8)eUapItemKind_REPETITIVE)
+    {
+        len = field_index(path, &index);
+        if (len == 0U)
+            return eAsterixStatus_ERR_FIELD;
+        path += len;
+    }
+    if (*path++ != '.')
+        return eAsterixStatus_ERR_FIELD;
+
+    // SUBFIELD (compound items)
+    len = field_token(path);
+    for (i = 0U; (i < item->n_groups) && (group == NULL); i++)
+    {
+        if (item->groups[i].name == NULL)
+            group = &item->groups[i];
+        else if (field_match(item->groups[i].name, path, len) && (path[len] == '.'))
+        {
+            group = &item->groups[i];
+            path += len + 1U;
+        }
+    }
+    if (group == NULL)
+        return eAsterixStatus_ERR_FIELD;
+
+    // FIELD
+    len = field_token(path);
+    if (path[len] != '\0')
+        return eAsterixStatus_ERR_FIELD;
+    for (i = 0U; (i < group->n_fields) && (field == NULL); i++)
+    {
+        if (field_match(group->fields[i].name, path, len))
+            field = &group->fields[i];
+    }
+    if ((field == NULL) || (field->width == 0U) || (field->width > FIELD_MAX_WIDTH))
+        return eAsterixStatus_ERR_FIELD;
+
+    first = field->bit % 8U;
+    acc->item     = item;
+    acc->field    = field;
+    acc->kind     = item->kind;
+    acc->subfield = group->subfield;
+    acc->index    = index;
+    acc->offset   = (u16)(field->bit / 8U);
+    acc->n_octets = (u8)((first + field->width + 7U) / 8U);
+    acc->shift    = (u8)((8U * acc->n_octets) - first - field->width);
+    acc->sign     = (field->type == (u8)eFieldType_SIGNED) ? field->width : 0U;
+    acc->mask     = (field->width == 32U) ? 0xFFFFFFFFU : (((u32)1U << field->width) - 1U);
+    return eAsterixStatus_OK;
+}
+
+const u8 *field_locate(const FieldAccessor *acc, const u8 *item, size_t length)
+{
+    size_t pos = 0U;
+
+    if (acc->kind == (u8)eUapItemKind_REPETITIVE)
+    {
+        /* REP octet, then the repetitions */
+        if ((length == 0U) || (acc->index >= item[0]))
+            return NULL;
+        pos = 1U + ((size_t)acc->index * acc->item->rep_len);
+    }
+    else if (acc->kind == (u8)eUapItemKind_COMPOUND)
+    {
+        const Compound *compound = acc->item->compound;
+        size_t n_octets = 1U;
+        size_t idx = 0U;
+
+        /* Primary subfield: FX-chained octets of 7 presence bits */
+        while ((n_octets <= length) && (item[n_octets - 1U] & 1U))
+            n_octets++;
+        if ((n_octets > length) || ((acc->subfield / 7U) >= n_octets)
+            || !((item[acc->subfield / 7U] >> (7U - (acc->subfield % 7U))) & 1U))
+            return NULL;
+
+        /* Then the present subfields, in order */
+        pos = n_octets;
+        for (idx = 0U; (idx < acc->subfield) && (idx < compound->n_subfields); idx++)
+        {
+            if ((item[idx / 7U] >> (7U - (idx % 7U))) & 1U)
+                pos += compound->subfields[idx].len;
+        }
+    }
+
+    if ((pos + acc->offset + acc->n_octets) > length)
+        return NULL;
+    return item + pos;
+}
+
+const char *field_label(const FieldMeta *field, s64 raw)
+{
+    size_t i = 0U;
+
+    for (i = 0U; i < field->n_labels; i++)
+    {
+        if ((s64)field->labels[i].value == raw)
+            return field->labels[i].label;
+    }
+    return NULL;
+}
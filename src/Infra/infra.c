@@ -1,53 +1,303 @@
 /**
  * @file infra.c
- * @brief 
+ * @brief
  * @version 0.1
  * @date 2026-03-07
- * 
+ *
  * @copyright Copyright (c) 2026
  */
+#include <string.h>
+
 #include <Infra/infra.h>
+#include <Common/constants.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Word-at-a-time engine
+ *
+ * Every access loads (or read-modify-writes) the 64-bit big-endian window that
+ * starts at the current byte, so any field of up to 57 bits is handled with a
+ * single shift and mask. Close to the end of the buffer, where a full window
+ * is not addressable, the bytes actually covered by the field are gathered one
+ * by one into the same left-aligned 64-bit accumulator.
+ */
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define BS_BSWAP64(x)   (x)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define BS_BSWAP64(x)   __builtin_bswap64(x)
+#endif
+
+/* Targets where an unaligned 8-byte memcpy becomes a single load/store */
+#if defined(BS_BSWAP64) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || \
+     defined(__powerpc64__) || defined(__s390x__))
+    #define BS_UNALIGNED_WORDS  1
+#else
+    #define BS_UNALIGNED_WORDS  0
+#endif
+
+static inline u64 bs_load_be64(const u8 * p)
+{
+#if BS_UNALIGNED_WORDS
+    u64 word;
+    memcpy(&word, p, sizeof(word));
+    return BS_BSWAP64(word);
+#else
+    return ((u64)p[0U] << 56U) | ((u64)p[1U] << 48U) |
+           ((u64)p[2U] << 40U) | ((u64)p[3U] << 32U) |
+           ((u64)p[4U] << 24U) | ((u64)p[5U] << 16U) |
+           ((u64)p[6U] <<  8U) |  (u64)p[7U];
+#endif
+}
+
+static inline void bs_store_be64(u8 * p, u64 word)
+{
+#if BS_UNALIGNED_WORDS
+    word = BS_BSWAP64(word);
+    memcpy(p, &word, sizeof(word));
+#else
+    size_t i = 0U;
+
+    for (i = 0U; i < 8U; i++) {
+        p[i] = (u8)(word >> (56U - (8U * i)));
+    }
+#endif
+}
+
+static inline void bs_advance(BitStream * bs, size_t n_bits)
+{
+    size_t bits = bs->bit_pos + n_bits;
+
+    bs->byte_pos += bits >> 3U;
+    bs->bit_pos   = bits & 7U;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void bs_init_segments(BitStream * bs, const BitStreamSegment * segs, size_t n_segs)
+{
+    size_t total = 0U;
+    size_t i = 0U;
+
+    for (i = 0U; i < n_segs; i++) {
+        total += segs[i].len;
+    }
+
+    bs_init(bs, segs[0U].data, total);
+    bs->segs    = segs;
+    bs->n_segs  = n_segs;
+    bs->seg_len = segs[0U].len;
+}
+
+/* Make the segment holding `pos` the current one; FALSE if pos is past the end */
+static eBoolean bs_locate(BitStream * bs, size_t pos)
+{
+    if (bs->segs == NULL) {
+        return (pos < bs->seg_len) ? eBoolean_TRUE : eBoolean_FALSE;
+    }
+
+    while ((pos < bs->seg_start) && (bs->seg_idx > 0U)) {
+        bs->seg_idx--;
+        bs->seg_start -= bs->segs[bs->seg_idx].len;
+    }
+    while ((pos >= (bs->seg_start + bs->segs[bs->seg_idx].len)) && ((bs->seg_idx + 1U) < bs->n_segs)) {
+        bs->seg_start += bs->segs[bs->seg_idx].len;
+        bs->seg_idx++;
+    }
+    bs->buffer  = bs->segs[bs->seg_idx].data;
+    bs->seg_len = bs->segs[bs->seg_idx].len;
+
+    return ((pos - bs->seg_start) < bs->seg_len) ? eBoolean_TRUE : eBoolean_FALSE;
+}
+
+void _bs_gather(BitStream * bs, size_t pos, u8 * dst, size_t n_bytes)
+{
+    while (n_bytes > 0U) {
+        size_t off = 0U;
+        size_t chunk = 0U;
+
+        if (!bs_locate(bs, pos)) {
+            /* Past the end of the data: never read outside the buffer */
+            memset(dst, 0, n_bytes);
+            bs_set_error(bs, eAsterixStatus_ERR_OVERRUN);
+            return;
+        }
+        off   = pos - bs->seg_start;
+        chunk = bs->seg_len - off;
+        chunk = (chunk < n_bytes) ? chunk : n_bytes;
+        memcpy(dst, &bs->buffer[off], chunk);
+        dst     += chunk;
+        pos     += chunk;
+        n_bytes -= chunk;
+    }
+}
+
+void _bs_scatter(BitStream * bs, size_t pos, const u8 * src, size_t n_bytes)
+{
+    while (n_bytes > 0U) {
+        size_t off = 0U;
+        size_t chunk = 0U;
+
+        if (!bs_locate(bs, pos)) {
+            bs_set_error(bs, eAsterixStatus_ERR_OVERRUN);
+            return;
+        }
+        off   = pos - bs->seg_start;
+        chunk = bs->seg_len - off;
+        chunk = (chunk < n_bytes) ? chunk : n_bytes;
+        memcpy(&bs->buffer[off], src, chunk);
+        src     += chunk;
+        pos     += chunk;
+        n_bytes -= chunk;
+    }
+}
+
+const u8 * _bs_ref(BitStream * bs, size_t n_bytes)
+{
+    AsterixArena * arena = bs->arena;
+    const u8 * p = NULL;
+
+    /* In place, if the octets lie in a single segment and no copy is asked */
+    if ((arena == NULL) && bs_locate(bs, bs->byte_pos)) {
+        p = bs_fast_ptr(bs, bs->byte_pos, n_bytes);
+    }
+
+    if (p == NULL) {
+        if ((arena == NULL) || (n_bytes > (arena->size - arena->used))) {
+            bs_set_error(bs, eAsterixStatus_ERR_ARENA);
+            return NULL;
+        }
+        p = &arena->data[arena->used];
+        _bs_gather(bs, bs->byte_pos, &arena->data[arena->used], n_bytes);
+        arena->used += n_bytes;
+    }
+
+    bs->byte_pos += n_bytes;
+    return p;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 
 void _bs_serialize(BitStream * bs, u64 value, size_t n_bits)
 {
-    u8 bit = 0U;
+    u8 tmp[8U];
+    u8 * p = NULL;
+    u64 mask  = 0U;
+    size_t shift = 0U;
+    size_t n_bytes = 0U;
     size_t i = 0U;
 
-    for (i = 0; i < n_bits; ++i) {
-        bit = (value >> (n_bits - 1U - i)) & 1U;
+    if (n_bits == 0U) {
+        return;
+    }
 
-        bs->buffer[bs->byte_pos] &= ~(1U << (7U - bs->bit_pos));
-        bs->buffer[bs->byte_pos] |=  (bit << (7U - bs->bit_pos));
+    /* Fields that do not fit in one window are written as two halves */
+    if ((bs->bit_pos + n_bits) > 64U) {
+        _bs_serialize(bs, value >> 32U, n_bits - 32U);
+        _bs_serialize(bs, value & MASK_32_BITS, 32U);
+        return;
+    }
 
-        bs->bit_pos++;
-        if (bs->bit_pos == 8U) {
-            bs->bit_pos = 0U;
-            bs->byte_pos++;
+    /* Sub-octet fields (flags, spares) only touch the current byte */
+    if ((bs->bit_pos + n_bits) <= 8U) {
+        u8 m = (u8)((0xFFU >> (8U - n_bits)) << (8U - bs->bit_pos - n_bits));
+        u8 v = (u8)(value << (8U - bs->bit_pos - n_bits));
+
+        p = bs_fast_ptr(bs, bs->byte_pos, 1U);
+        if (p != NULL) {
+            p[0U] = (u8)((p[0U] & ~m) | (v & m));
+        } else {
+            _bs_gather(bs, bs->byte_pos, tmp, 1U);
+            tmp[0U] = (u8)((tmp[0U] & ~m) | (v & m));
+            _bs_scatter(bs, bs->byte_pos, tmp, 1U);
+        }
+        bs_advance(bs, n_bits);
+        return;
+    }
+
+    shift = 64U - bs->bit_pos - n_bits;
+    mask  = (~(u64)0U >> (64U - n_bits)) << shift;
+    value = (value << shift) & mask;
+
+    p = bs_fast_ptr(bs, bs->byte_pos, 8U);
+    if (p != NULL) {
+        bs_store_be64(p, (bs_load_be64(p) & ~mask) | value);
+    } else {
+        n_bytes = (bs->bit_pos + n_bits + 7U) >> 3U;
+        p = bs_fast_ptr(bs, bs->byte_pos, n_bytes);
+        if (p == NULL) {
+            _bs_gather(bs, bs->byte_pos, tmp, n_bytes);
+        }
+
+        for (i = 0U; i < n_bytes; i++) {
+            u8 m = (u8)(mask  >> (56U - (8U * i)));
+            u8 v = (u8)(value >> (56U - (8U * i)));
+            u8 * byte = (p != NULL) ? &p[i] : &tmp[i];
+            *byte = (u8)((*byte & ~m) | v);
+        }
+
+        if (p == NULL) {
+            _bs_scatter(bs, bs->byte_pos, tmp, n_bytes);
         }
     }
+
+    bs_advance(bs, n_bits);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-u64 _bs_deserialize(BitStream * bs, size_t nbits)
+u64 _bs_deserialize(BitStream * bs, size_t n_bits)
 {
-    u64 value = 0U;
+    u8 tmp[8U];
+    const u8 * p = NULL;
+    u64 window = 0U;
+    u64 value  = 0U;
+    size_t n_bytes = 0U;
     size_t i = 0U;
-    u8 bit = 0U;
 
-    for (i = 0U; i < nbits; i++) {
-        bit = ((bs->buffer[bs->byte_pos]) >> (7U - bs->bit_pos)) & 1U;
+    if (n_bits == 0U) {
+        return 0U;
+    }
+
+    /* Fields that do not fit in one window are read as two halves */
+    if ((bs->bit_pos + n_bits) > 64U) {
+        value = _bs_deserialize(bs, n_bits - 32U) << 32U;
+        return value | _bs_deserialize(bs, 32U);
+    }
 
-        value = (value << 1U) | bit;
-        bs->bit_pos++;
-        if (bs->bit_pos == 8U) {
-            bs->bit_pos = 0U;
-            bs->byte_pos++;
+    /* Sub-octet fields (flags, spares) only touch the current byte */
+    if ((bs->bit_pos + n_bits) <= 8U) {
+        p = bs_fast_ptr(bs, bs->byte_pos, 1U);
+        if (p == NULL) {
+            _bs_gather(bs, bs->byte_pos, tmp, 1U);
+            p = tmp;
         }
+        value = (p[0U] >> (8U - bs->bit_pos - n_bits)) & (0xFFU >> (8U - n_bits));
+        bs_advance(bs, n_bits);
+        return value;
     }
 
+    p = bs_fast_ptr(bs, bs->byte_pos, 8U);
+    if (p != NULL) {
+        window = bs_load_be64(p);
+    } else {
+        n_bytes = (bs->bit_pos + n_bits + 7U) >> 3U;
+        p = bs_fast_ptr(bs, bs->byte_pos, n_bytes);
+        if (p == NULL) {
+            _bs_gather(bs, bs->byte_pos, tmp, n_bytes);
+            p = tmp;
+        }
+
+        for (i = 0U; i < n_bytes; i++) {
+            window |= (u64)p[i] << (56U - (8U * i));
+        }
+    }
+
+    value = (window << bs->bit_pos) >> (64U - n_bits);
+    bs_advance(bs, n_bits);
+
     return value;
 }
 
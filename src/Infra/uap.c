@@ -0,0 +1,500 @@
+/**
+ * @file uap.c
+ * @brief Generic User Application Profile (UAP) engine
+ */
+#include <string.h>
+
+#include <Infra/uap.h>
+#include <Infra/cpu_dispatch.h>
+
+/*
+ * FSPEC octet <-> presence mask
+ *
+ * Octet i carries FRNs 7i+1 (bit 7) to 7i+7 (bit 1) and the FX bit (bit 0),
+ * while the mask holds them in bits 7i to 7i+6: each octet maps to its 7 mask
+ * bits by reversing bits 7..1, done with this table in both directions.
+ */
+static const u8 UAP_REV7[128] = {
+    0x00, 0x40, 0x20, 0x60, 0x10, 0x50, 0x30, 0x70, 0x08, 0x48, 0x28, 0x68, 0x18, 0x58, 0x38, 0x78,
+    0x04, 0x44, 0x24, 0x64, 0x14, 0x54, 0x34, 0x74, 0x0C, 0x4C, 0x2C, 0x6C, 0x1C, 0x5C, 0x3C, 0x7C,
+    0x02, 0x42, 0x22, 0x62, 0x12, 0x52, 0x32, 0x72, 0x0A, 0x4A, 0x2A, 0x6A, 0x1A, 0x5A, 0x3A, 0x7A,
+    0x06, 0x46, 0x26, 0x66, 0x16, 0x56, 0x36, 0x76, 0x0E, 0x4E, 0x2E, 0x6E, 0x1E, 0x5E, 0x3E, 0x7E,
+    0x01, 0x41, 0x21, 0x61, 0x11, 0x51, 0x31, 0x71, 0x09, 0x49, 0x29, 0x69, 0x19, 0x59, 0x39, 0x79,
+    0x05, 0x45, 0x25, 0x65, 0x15, 0x55, 0x35, 0x75, 0x0D, 0x4D, 0x2D, 0x6D, 0x1D, 0x5D, 0x3D, 0x7D,
+    0x03, 0x43, 0x23, 0x63, 0x13, 0x53, 0x33, 0x73, 0x0B, 0x4B, 0x2B, 0x6B, 0x1B, 0x5B, 0x3B, 0x7B,
+    0x07, 0x47, 0x27, 0x67, 0x17, 0x57, 0x37, 0x77, 0x0F, 0x4F, 0x2F, 0x6F, 0x1F, 0x5F, 0x3F, 0x7F,
+};
+
+/* =============================== DE/ENCODE =============================== */
+
+eAsterixStatus uap_write_presence(BitStream *bs, u64 present)
+{
+    u8 tmp[UAP_FSPEC_MAX_OCTETS];
+    u8 *p = NULL;
+    size_t n_octets = uap_fspec_octets(present);
+    size_t i = 0U;
+
+    if (!bs_require(bs, n_octets))
+        return bs_status(bs);
+
+    p = bs_write_ptr(bs, tmp, n_octets);
+    for (i = 0U; i < n_octets; i++)
+    {
+        p[i] = (u8)((UAP_REV7[(present >> (7U * i)) & 0x7FU] << 1U) | (((i + 1U) < n_octets) ? 0x01U : 0x00U));
+    }
+    bs_write_done(bs, p, tmp, n_octets);
+
+    return bs_status(bs);
+}
+
+size_t uap_peek_presence(BitStream *bs, u64 *present)
+{
+    u8 tmp[UAP_FSPEC_MAX_OCTETS];
+    const u8 *p = NULL;
+    size_t avail = 0U;
+    size_t n_octets = 0U;
+    size_t i = 0U;
+    u64 mask = 0U;
+
+    *present = 0U;
+    if (bs_status(bs) != eAsterixStatus_OK)
+        return 0U;
+
+    /* Find the end of the FX chain in one pass over what the block holds */
+    avail = (bs->limit > bs->byte_pos) ? (bs->limit - bs->byte_pos) : 0U;
+    avail = (avail < UAP_FSPEC_MAX_OCTETS) ? avail : UAP_FSPEC_MAX_OCTETS;
+    p = bs_fast_ptr(bs, bs->byte_pos, avail);
+    if (p == NULL)
+    {
+        _bs_gather(bs, bs->byte_pos, tmp, avail);
+        p = tmp;
+    }
+    /* A single octet, the most common chain, needs no scan */
+    if ((avail != 0U) && ((p[0U] & 0x01U) == 0U))
+    {
+        *present = (u64)UAP_REV7[p[0U] >> 1U];
+        return 1U;
+    }
+    n_octets = asterix_fx_scan(p, avail);
+    if (n_octets == 0U)
+    {
+        bs_set_error(bs, (avail < UAP_FSPEC_MAX_OCTETS) ? eAsterixStatus_ERR_OVERRUN : eAsterixStatus_ERR_FSPEC);
+        return 0U;
+    }
+
+    for (i = 0U; i < n_octets; i++)
+    {
+        mask |= (u64)UAP_REV7[p[i] >> 1U] << (7U * i);
+    }
+    *present = mask;
+    return n_octets;
+}
+
+eAsterixStatus uap_encode_fspec(BitStream *bs, const Uap *uap, u64 present)
+{
+    if ((present & ~uap->valid) != 0U)
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_FSPEC);
+        return bs_status(bs);
+    }
+    return uap_write_presence(bs, present);
+}
+
+eAsterixStatus uap_decode_fspec(BitStream *bs, const Uap *uap, u64 *present)
+{
+    u64 mask = 0U;
+    size_t n_octets = uap_peek_presence(bs, &mask);
+
+    *present = 0U;
+    if (n_octets == 0U)
+        return bs_status(bs);
+    if ((mask & ~uap->valid) != 0U)
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_FSPEC);
+        return bs_status(bs);
+    }
+
+    bs->byte_pos += n_octets;
+    *present = mask;
+    return bs_status(bs);
+}
+
+eAsterixStatus uap_encode_items(BitStream *bs, const Uap *uap, u64 present, const void *record)
+{
+    const u8 *base = (const u8 *)record;
+
+    if ((present & ~uap->valid) != 0U)
+    {
+        bs_set_error(bs, eAsterixStatus_ERR_FSPEC);
+        return bs_status(bs);
+    }
+
+    /* Visit the present items only, lowest FRN first */
+    while ((present != 0U) && (bs_status(bs) == eAsterixStatus_OK))
+    {
+        const UapItem *it = &uap->items[uap_ctz64(present)];
+
+        present &= present - 1U;
+        /* Fixed items are checked here, the others check their own length */
+        if ((it->kind == eUapItemKind_FIXED) && !bs_require(bs, it->len))
+            break;
+        it->encode(bs, base + it->offset);
+    }
+    return bs_status(bs);
+}
+
+/* Encoded length of a variable-length item, 0 if it cannot be measured */
+static size_t uap_item_size(const UapItem *it, const u8 *base)
+{
+    if (it->kind == eUapItemKind_FIXED)
+        return it->len;
+    if (it->size != NULL)
+        return it->size(base + it->offset);
+    return 0U;
+}
+
+static const UapPlan *uap_plan_find(const Uap *uap, u64 present);
+
+size_t uap_encoded_size(const Uap *uap, u64 present, const void *record)
+{
+    const u8 *base = (const u8 *)record;
+    const UapPlan *plan = NULL;
+    size_t len = uap_fspec_octets(present);
+    size_t size = 0U;
+    size_t i = 0U;
+
+    if ((present & ~uap->valid) != 0U)
+        return 0U;
+
+    /* The leading fixed items are counted at once from the plan when the
+     * pattern was decoded before, only the items past them are measured: the
+     * lookup leaves the cache and its statistics to the decoders */
+    plan = uap_plan_find(uap, present);
+    if (plan != NULL)
+    {
+        len += plan->fixed_len;
+        for (i = plan->n_fixed; i < plan->n_items; i++)
+        {
+            size = uap_item_size(&uap->items[plan->index[i]], base);
+            if (size == 0U)
+                return 0U;
+            len += size;
+        }
+        return len;
+    }
+
+    while (present != 0U)
+    {
+        size = uap_item_size(&uap->items[uap_ctz64(present)], base);
+        present &= present - 1U;
+        if (size == 0U)
+            return 0U;
+        len += size;
+    }
+    return len;
+}
+
+/* Measure the item at the current position and move past it, without
+ * decoding it */
+static void uap_skip_item(BitStream *bs, const UapItem *it)
+{
+    size_t len = (it->kind == eUapItemKind_FIXED) ? it->len : it->length(bs);
+
+    if ((len != 0U) && bs_require(bs, len))
+        bs->byte_pos += len;
+}
+
+/* Decode the wanted items of a record through its plan: one length check for
+ * the leading fixed items, each then read from its octets at its offset in
+ * the plan (through the BitStream if the octets straddle two segments) and
+ * the unwanted ones passed over by that offset, then the remaining ones as
+ * they come */
+static eAsterixStatus uap_decode_plan(BitStream *bs, const Uap *uap, const UapPlan *plan, u64 wanted, u8 *base)
+{
+    size_t start = bs->byte_pos;
+    const u8 *data = NULL;
+    size_t i = 0U;
+
+    if (!bs_require(bs, plan->fixed_len))
+        return bs_status(bs);
+    data = bs_fast_ptr(bs, start, plan->fixed_len);
+    for (i = 0U; i < plan->n_fixed; i++)
+    {
+        const UapItem *it = &uap->items[plan->index[i]];
+
+        if (((wanted >> plan->index[i]) & 1U) == 0U)
+            continue;
+        if ((data != NULL) && (it->read != NULL))
+        {
+            it->read(data + plan->offset[i], base + it->offset);
+        }
+        else
+        {
+            bs->byte_pos = start + plan->offset[i];
+            it->decode(bs, base + it->offset);
+        }
+    }
+    bs->byte_pos = start + plan->fixed_len;
+    for (; (i < plan->n_items) && (bs_status(bs) == eAsterixStatus_OK); i++)
+    {
+        const UapItem *it = &uap->items[plan->index[i]];
+
+        if (((wanted >> plan->index[i]) & 1U) == 0U)
+            uap_skip_item(bs, it);
+        else if ((it->kind != eUapItemKind_FIXED) || bs_require(bs, it->len))
+            it->decode(bs, base + it->offset);
+    }
+    return bs_status(bs);
+}
+
+eAsterixStatus uap_decode_items(BitStream *bs, const Uap *uap, u64 present, void *record)
+{
+    return uap_decode_selected(bs, uap, present, present, record);
+}
+
+eAsterixStatus uap_decode_selected(BitStream *bs, const Uap *uap, u64 present, u64 wanted, void *record)
+{
+    u8 *base = (u8 *)record;
+    const UapPlan *plan = uap_plan(uap, present);
+
+    if (plan != NULL)
+        return uap_decode_plan(bs, uap, plan, wanted, base);
+
+    /* present was validated against the UAP by uap_decode_fspec() */
+    while ((present != 0U) && (bs_status(bs) == eAsterixStatus_OK))
+    {
+        u64 bit = present & (~present + 1U);
+        const UapItem *it = &uap->items[uap_ctz64(present)];
+
+        present &= present - 1U;
+        if ((wanted & bit) == 0U)
+            uap_skip_item(bs, it);
+        else if ((it->kind != eUapItemKind_FIXED) || bs_require(bs, it->len))
+            it->decode(bs, base + it->offset);
+    }
+    return bs_status(bs);
+}
+
+eAsterixStatus uap_index_items(BitStream *bs, const Uap *uap, u64 present, UapItemRef *refs)
+{
+    memset(refs, 0, uap->n_frn * sizeof(*refs));
+
+    /* present was validated against the UAP by uap_decode_fspec() */
+    while ((present != 0U) && (bs_status(bs) == eAsterixStatus_OK))
+    {
+        size_t idx = uap_ctz64(present);
+        const UapItem *it = &uap->items[idx];
+        size_t len = (it->kind == eUapItemKind_FIXED) ? it->len : it->length(bs);
+
+        present &= present - 1U;
+        if ((len == 0U) || !bs_require(bs, len))
+            break;
+        refs[idx].frn    = (u8)(idx + 1U);
+        refs[idx].offset = (u16)bs->byte_pos;
+        refs[idx].length = (u16)len;
+        bs->byte_pos += len;
+    }
+    return bs_status(bs);
+}
+
+eAsterixStatus uap_skip_items(BitStream *bs, const Uap *uap, u64 present)
+{
+    /* present was validated against the UAP by uap_decode_fspec() */
+    while ((present != 0U) && (bs_status(bs) == eAsterixStatus_OK))
+    {
+        const UapItem *it = &uap->items[uap_ctz64(present)];
+        size_t len = (it->kind == eUapItemKind_FIXED) ? it->len : it->length(bs);
+
+        present &= present - 1U;
+        if ((len == 0U) || !bs_require(bs, len))
+            break;
+        bs->byte_pos += len;
+    }
+    return bs_status(bs);
+}
+
+/* ================================ BUILDER ================================ */
+
+/* Move n octets of the BitStream forward from src to dst (dst > src) */
+static void uap_move_forward(BitStream *bs, size_t dst, size_t src, size_t n)
+{
+    u8 tmp[64];
+    u8 *p = bs_fast_ptr(bs, src, (dst - src) + n);
+    size_t chunk = 0U;
+
+    if (p != NULL)
+    {
+        memmove(p + (dst - src), p, n);
+        return;
+    }
+    /* Segmented buffer: descending chunks never overwrite octets still to be read */
+    while (n > 0U)
+    {
+        chunk = (n < sizeof(tmp)) ? n : sizeof(tmp);
+        n -= chunk;
+        _bs_gather(bs, src + n, tmp, chunk);
+        _bs_scatter(bs, dst + n, tmp, chunk);
+    }
+}
+
+eAsterixStatus uap_builder_begin(UapBuilder *builder, BitStream *bs, const Uap *uap)
+{
+    builder->bs       = bs;
+    builder->uap      = uap;
+    builder->start    = bs->byte_pos;
+    builder->reserved = 1U;
+    builder->present  = 0U;
+    builder->last_frn = 0U;
+
+    /* The FSPEC is written last, once the items are known */
+    bs_skip(bs, builder->reserved);
+    return bs_status(bs);
+}
+
+eAsterixStatus uap_builder_grow(UapBuilder *builder, u8 frn)
+{
+    BitStream *bs = builder->bs;
+    size_t n_octets = uap_fspec_octets(UAP_FRN_BIT(frn));
+    size_t extra = n_octets - builder->reserved;
+    size_t items = builder->start + builder->reserved;
+
+    if (!bs_require(bs, extra))
+        return bs_status(bs);
+
+    uap_move_forward(bs, items + extra, items, bs->byte_pos - items);
+    bs->byte_pos += extra;
+    builder->reserved = n_octets;
+    return bs_status(bs);
+}
+
+eAsterixStatus uap_builder_end(UapBuilder *builder)
+{
+    BitStream *bs = builder->bs;
+    size_t end = bs->byte_pos;
+
+    if (bs_status(bs) != eAsterixStatus_OK)
+        return bs_status(bs);
+
+    /* The reserved octets are those of the last FRN put: the FSPEC fills them */
+    bs->byte_pos = builder->start;
+    if (uap_write_presence(bs, builder->present) == eAsterixStatus_OK)
+        bs->byte_pos = end;
+    return bs_status(bs);
+}
+
+/* ================================ PLANS ================================ */
+
+#ifndef ASTERIX_NO_PLAN_CACHE
+
+/* Direct-mapped, one cache per thread: no locking on the decode path */
+static ASTERIX_THREAD_LOCAL UapPlan uap_plan_cache[UAP_PLAN_CACHE_SIZE];
+static ASTERIX_THREAD_LOCAL UapPlanStats uap_plan_cache_stats;
+
+static void uap_plan_build(UapPlan *plan, const Uap *uap, u64 present)
+{
+    size_t offset = 0U;
+    eBoolean fixed = eBoolean_TRUE;
+
+    plan->uap       = uap;
+    plan->present   = present;
+    plan->n_items   = 0U;
+    plan->n_fixed   = 0U;
+    plan->fixed_len = 0U;
+    while (present != 0U)
+    {
+        size_t idx = uap_ctz64(present);
+        const UapItem *it = &uap->items[idx];
+
+        present &= present - 1U;
+        plan->index[plan->n_items] = (u8)idx;
+        if (fixed && (it->kind == eUapItemKind_FIXED))
+        {
+            plan->offset[plan->n_items] = (u16)offset;
+            offset += it->len;
+            plan->n_fixed++;
+        }
+        else
+        {
+            fixed = eBoolean_FALSE;
+        }
+        plan->n_items++;
+    }
+    plan->fixed_len = (u16)offset;
+}
+
+/* Cache slot of a pattern: Fibonacci hashing, salted with the category */
+static UapPlan *uap_plan_slot(const Uap *uap, u64 present)
+{
+    u64 hash = (present ^ ((u64)uap->cat << 56U)) * 0x9E3779B97F4A7C15ULL;
+
+    return &uap_plan_cache[(size_t)(hash >> 32U) & (UAP_PLAN_CACHE_SIZE - 1U)];
+}
+
+/* Cached plan of a pattern, NULL if not cached: neither counts nor builds */
+static const UapPlan *uap_plan_find(const Uap *uap, u64 present)
+{
+    const UapPlan *plan = uap_plan_slot(uap, present);
+
+    if ((plan->uap == uap) && (plan->present == present))
+        return plan;
+    return NULL;
+}
+
+const UapPlan *uap_plan(const Uap *uap, u64 present)
+{
+    UapPlan *plan = NULL;
+
+    if (uap_popcount64(present) > UAP_PLAN_MAX_ITEMS)
+        return NULL;
+
+    plan = uap_plan_slot(uap, present);
+    if ((plan->uap == uap) && (plan->present == present))
+    {
+        uap_plan_cache_stats.hits++;
+        return plan;
+    }
+
+    uap_plan_cache_stats.misses++;
+    if (plan->uap != NULL)
+        uap_plan_cache_stats.evictions++;
+    uap_plan_build(plan, uap, present);
+    return plan;
+}
+
+void uap_plan_stats(UapPlanStats *stats)
+{
+    *stats = uap_plan_cache_stats;
+}
+
+void uap_plan_reset(void)
+{
+    memset(uap_plan_cache, 0, sizeof(uap_plan_cache));
+    memset(&uap_plan_cache_stats, 0, sizeof(uap_plan_cache_stats));
+}
+
+#else
+
+static const UapPlan *uap_plan_find(const Uap *uap, u64 present)
+{
+    (void)uap;
+    (void)present;
+    return NULL;
+}
+
+const UapPlan *uap_plan(const Uap *uap, u64 present)
+{
+    (void)uap;
+    (void)present;
+    return NULL;
+}
+
+void uap_plan_stats(UapPlanStats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+void uap_plan_reset(void)
+{
+}
+
+#endif /* ASTERIX_NO_PLAN_CACHE */
@@ -0,0 +1,1212 @@
+#!/usr/bin/env python3
+"""
+@file asterix_gen.py
+@brief Generate the codecs of an ASTERIX category from its specification
+
+Reads the description of a category in the JSON format of the open
+asterix-specs project (https://zoranbosnjak.github.io/asterix-specs) and
+writes, in the style of the library (see include/Categories/I034):
+
+- one I<CAT>_<ITEM>.h/.c pair per data item: enums of the code tables, item
+  structure, LSB/SCALE macros and scaled accessors, straight-line encode and
+  decode (constant shifts and masks over the octets of the item), length,
+  encoded size and skip functions, field metadata (see include/Infra/field.h)
+  and print helper
+- I<CAT>.h/.c: FRNs, record structure, UAP table, record codecs, field
+  metadata table and AsterixCategory of the category
+- I<CAT>_config.h: one I<CAT>_WITH_xxx switch per item, as I034_config.h
+
+Supported subset of the format (the "rule" wrappers of the specification,
+{"type": "ContextFree", "value": ...}, may be omitted):
+
+  category    {"number", "title", "edition": {"major", "minor"},
+               "catalogue": [item...], "uap": {"type": "Uap", "items": [...]}}
+  item        {"name", "title", "definition", "variation" | "rule"}
+  Element     {"type": "Element", "size": bits, "rule": content}
+  Group       {"type": "Group", "items": [subitem | {"spare": true, "length": bits}]}
+  Extended    {"type": "Extended", "items": [subitem | spare | null (FX bit)]}
+  Repetitive  {"type": "Repetitive", "rep": {"type": "Regular", "size": 8}, "variation": ...}
+  Compound    {"type": "Compound", "items": [subitem | null (spare subfield)]}
+  Explicit    {"type": "Explicit", "expl": "ReservedExpansion" | "SpecialPurpose" | null}
+  content     {"type": "Raw"} | {"type": "Table", "values": [[value, "text"]...]}
+              | {"type": "Quantity", "signed": bool, "lsb": number, "unit": "s"}
+              | {"type": "Integer", "signed": bool} | {"type": "String", ...}
+  number      n | {"type": "Integer", "value": n}
+              | {"type": "Div", "numerator": number, "denominator": number}
+              | {"type": "Pow", "base": n, "exponent": n}
+
+The output goes to its own tree (see 'make generate') and never overwrites
+the hand-written categories.
+
+Usage: asterix_gen.py SPEC.json OUT_DIR
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from fractions import Fraction
+
+# Section banners, as written in the hand-written items
+BANNERS = {
+    'MACROS':       '/* ================================= MACROS ================================= */',
+    'ENUMS':        '/* ================================= ENUMS ================================= */',
+    'STRUCTS':      '/* ================================= STRUCTS ================================= */',
+    'ACCESSORS':    '/* =============================== ACCESSORS =============================== */',
+    'DE/ENCODE':    '/* =============================== DE/ENCODE =============================== */',
+    'METADATA':     '/* ================================ METADATA =============================== */',
+    'EXTRA FUNCS':  '/* ============================== EXTRA FUNCS ============================== */',
+    'UAP':          '/* ================================== UAP ================================== */',
+    'REGISTRY':     '/* =============================== REGISTRY =============================== */',
+}
+
+# What encoded_size_ returns, by kind of item ({0}: item type)
+SIZE_RETURNS = {
+    'FIXED':        'Length of the item ({0}_LEN)',
+    'EXTENDED':     'Length of the extents up to the first FX flag clear',
+    'REPETITIVE':   'Length of the item (REP octet and REP repetitions)',
+    'COMPOUND':     'Length of the primary subfield and of the present subfields',
+    'EXPLICIT':     'Length of the item (item->LEN, which counts the LEN octet)',
+}
+
+
+class SpecError(Exception):
+    pass
+
+
+def banner(title):
+    return BANNERS[title]
+
+
+def align_defines(lines):
+    """Align the values of the one-line object-like macros of a file"""
+    pattern = re.compile(r'^#define ([A-Za-z0-9_]+)\s+(.*)$')
+    width = max([len(m.group(1)) for m in map(pattern.match, lines) if m and not m.group(2).endswith('\\')] + [0])
+    out = []
+    for line in lines:
+        m = pattern.match(line)
+        if m and not m.group(2).endswith('\\'):
+            line = '#define %-*s %s' % (width, m.group(1), m.group(2))
+        out.append(line)
+    return out
+
+
+def u(n):
+    return '%dU' % n
+
+
+def c_ident(text):
+    """Upper-case C identifier from a free text (code table entries)"""
+    text = re.sub(r'\(.*?\)', ' ', text)
+    words = [w for w in re.split(r'[^A-Za-z0-9]+', text.upper()) if w]
+    ident = '_'.join(words[:4])
+    if not ident:
+        return ''
+    return ('V' + ident) if ident[0].isdigit() else ident
+
+
+# =============================== SPECIFICATION ===============================
+
+def node_type(node):
+    return node.get('type', node.get('tag')) if isinstance(node, dict) else None
+
+
+def unwrap(node):
+    """Strip the ContextFree rule wrappers of the specification"""
+    while node_type(node) == 'ContextFree':
+        node = node.get('value', node.get('contents'))
+    if node_type(node) == 'Dependent':
+        raise SpecError('context-dependent rules are not supported')
+    return node
+
+
+def number(node):
+    """Exact value and text (as written in the specification) of a number"""
+    if isinstance(node, (int, float)):
+        value = Fraction(node).limit_denominator(1 << 32)
+        return value, str(node)
+    kind = node_type(node)
+    if kind in ('Integer', 'NumInt'):
+        return Fraction(node['value']), str(node['value'])
+    if kind in ('Div', 'NumDiv'):
+        num, num_text = number(node['numerator'])
+        den, den_text = number(node['denominator'])
+        return num / den, '%s/%s' % (num_text, den_text)
+    if kind in ('Pow', 'NumPow'):
+        base, exp = node['base'], node['exponent']
+        return Fraction(base) ** exp, '%d^%d' % (base, exp)
+    raise SpecError('unsupported number %r' % (node,))
+
+
+class Field(object):
+    """One element of a fixed layout, bit counted from the first octet"""
+
+    def __init__(self, name, title, bit, width, content):
+        self.name = name
+        self.title = title
+        self.bit = bit
+        self.width = width
+        self.kind = 'raw'
+        self.signed = False
+        self.lsb = Fraction(1)
+        self.lsb_text = '1'
+        self.unit = None
+        self.values = []
+
+        content = unwrap(content) if content is not None else {'type': 'Raw'}
+        kind = node_type(content)
+        if kind == 'Table':
+            self.kind = 'table'
+            self.values = [(int(v[0]), str(v[1])) for v in content.get('values', [])]
+        elif kind == 'Quantity':
+            self.kind = 'quantity'
+            self.signed = bool(content.get('signed', False))
+            self.lsb, self.lsb_text = number(content.get('lsb', 1))
+            self.unit = content.get('unit')
+        elif kind == 'Integer':
+            self.signed = bool(content.get('signed', False))
+        elif kind in ('Raw', 'String', 'Bds', None):
+            pass
+        else:
+            raise SpecError('%s: unsupported element content %r' % (name, kind))
+        if width > 64:
+            raise SpecError('%s: elements wider than 64 bits are not supported' % name)
+
+    @property
+    def end(self):
+        return self.bit + self.width
+
+    @property
+    def bits(self):
+        return 8 if self.width <= 8 else 16 if self.width <= 16 else 32 if self.width <= 32 else 64
+
+    @property
+    def raw_type(self):
+        return ('s' if self.signed else 'u') + str(self.bits)
+
+    @property
+    def word(self):
+        """Type the element is shifted in"""
+        return 'u64' if self.width > 32 else 'u32'
+
+
+class Layout(object):
+    """Fixed layout: elements and spares over whole octets"""
+
+    def __init__(self, fields, n_bits, where):
+        if n_bits % 8 != 0:
+            raise SpecError('%s: %d bits is not a whole number of octets' % (where, n_bits))
+        self.fields = fields
+        self.len = n_bits // 8
+
+
+def parse_layout(variation, where, fx_marks=False):
+    """Fields of an Element or Group variation; with fx_marks, None entries
+    of an Extended variation are FX bits and their positions are returned"""
+    fields = []
+    fx_bits = []
+    bit = [0]
+
+    def walk(node, name, title):
+        node = unwrap(node)
+        kind = node_type(node)
+        if kind == 'Element':
+            fields.append(Field(name, title, bit[0], int(node['size']), node.get('rule', node.get('content'))))
+            bit[0] += int(node['size'])
+        elif kind in ('Group', 'Extended'):
+            for sub in node.get('items', []):
+                if sub is None:
+                    if not fx_marks:
+                        raise SpecError('%s: FX bit outside an Extended item' % where)
+                    fx_bits.append(bit[0])
+                    bit[0] += 1
+                elif sub.get('spare') or node_type(sub) == 'Spare':
+                    bit[0] += int(sub.get('length', sub.get('size', 0)))
+                else:
+                    walk(sub.get('variation', sub.get('rule')), sub['name'], sub.get('title', sub['name']))
+        else:
+            raise SpecError('%s: unsupported variation %r inside a fixed layout' % (where, kind))
+
+    walk(variation, 'VALUE', 'Value')
+    layout = Layout(fields, bit[0], where)
+    return (layout, fx_bits) if fx_marks else layout
+
+
+class Item(object):
+    """One data item of the catalogue"""
+
+    def __init__(self, cat, node):
+        self.id = str(node['name'])
+        self.title = node.get('title', '').strip()
+        self.definition = ' '.join(str(node.get('definition', '')).split())
+        self.type = 'I%03d_%s' % (cat, self.id)
+        self.label = 'I%03d/%s' % (cat, self.id)
+        self.layout = None
+        self.extents = []
+        self.subfields = []
+        self.expl = None
+
+        variation = unwrap(node.get('variation', node.get('rule')))
+        kind = node_type(variation)
+        where = self.label
+        if kind in ('Element', 'Group'):
+            self.kind = 'FIXED'
+            self.layout = parse_layout(variation, where)
+        elif kind == 'Extended':
+            self.kind = 'EXTENDED'
+            self.layout, fx_bits = parse_layout(variation, where, fx_marks=True)
+            # Octets of each extent, the FX bit ending the last one
+            start = 0
+            for fx in fx_bits:
+                if (fx + 1) % 8 != 0:
+                    raise SpecError('%s: FX bit %d does not end an octet' % (where, fx))
+                self.extents.append((start // 8, (fx + 1 - start) // 8))
+                start = fx + 1
+            if not self.extents or start != 8 * self.layout.len:
+                raise SpecError('%s: every extent must end with an FX bit' % where)
+        elif kind == 'Repetitive':
+            self.kind = 'REPETITIVE'
+            rep = variation.get('rep', {'type': 'Regular', 'size': 8})
+            if node_type(rep) not in ('Regular', 'RepetitiveRegular') or int(rep.get('size', 8)) != 8:
+                raise SpecError('%s: only a REP octet (Regular, 8 bits) is supported' % where)
+            self.layout = parse_layout(variation.get('variation', variation.get('rule')), where)
+        elif kind == 'Compound':
+            self.kind = 'COMPOUND'
+            if variation.get('fspec') not in (None, 0):
+                raise SpecError('%s: fixed-length primary subfields are not supported' % where)
+            for sub in variation.get('items', []):
+                if sub is None:
+                    self.subfields.append(None)
+                    continue
+                sub_var = sub.get('variation', sub.get('rule'))
+                self.subfields.append((sub['name'], sub.get('title', sub['name']),
+                                       parse_layout(sub_var, '%s.%s' % (where, sub['name']))))
+            if len(self.subfields) > 28:
+                raise SpecError('%s: more than 28 subfields' % where)
+        elif kind == 'Explicit':
+            self.kind = 'EXPLICIT'
+            self.expl = {'ReservedExpansion': 'RE', 'SpecialPurpose': 'SP'}.get(variation.get('expl'))
+        else:
+            raise SpecError('%s: unsupported variation %r' % (where, kind))
+
+    @property
+    def fixed_len(self):
+        return self.layout.len if self.kind == 'FIXED' else 0
+
+
+class Category(object):
+
+    def __init__(self, node):
+        if 'contents' in node and isinstance(node['contents'], dict):
+            node = node['contents']
+        self.number = int(node['number'])
+        self.title = node.get('title', '')
+        edition = node.get('edition', {})
+        self.edition = '%s.%s' % (edition.get('major', '?'), edition.get('minor', '?'))
+        self.prefix = 'I%03d' % self.number
+        self.items = [Item(self.number, item) for item in node.get('catalogue', [])]
+        by_id = dict((item.id, item) for item in self.items)
+
+        uap = node.get('uap', {})
+        names = uap.get('items', uap.get('contents', [])) if isinstance(uap, dict) else uap
+        if node_type(uap) not in (None, 'Uap'):
+            raise SpecError('only a single UAP is supported')
+        self.uap = []
+        for name in names:
+            if name is None:
+                self.uap.append(None)
+            elif str(name) in by_id:
+                self.uap.append(by_id[str(name)])
+            else:
+                raise SpecError('UAP references unknown item %s' % name)
+        if len(self.uap) > 64:
+            raise SpecError('UAP of more than 64 FRNs')
+
+
+# ================================= C SNIPPETS =================================
+
+def octet_mask(field, k):
+    lo = max(field.bit, 8 * k)
+    hi = min(field.end, 8 * k + 8)
+    mask = 0
+    for p in range(lo, hi):
+        mask |= 1 << (7 - (p - 8 * k))
+    return mask
+
+
+def octets_of(field):
+    return range(field.bit // 8, (field.end - 1) // 8 + 1)
+
+
+def pack_octets(layout, value_of, fx=None):
+    """Lines of raw[k] = ... for every octet k of a layout; value_of(field) is
+    the C expression of the raw value of a field, fx maps an octet to its FX term"""
+    octets = []
+    for k in range(layout.len):
+        lines = []
+        octets.append(lines)
+        terms = []
+        for f in layout.fields:
+            if k not in octets_of(f):
+                continue
+            shift = 8 * k + 8 - f.end
+            value = '(%s)%s' % (f.word, value_of(f))
+            if shift > 0:
+                value = '(%s << %s)' % (value, u(shift))
+            elif shift < 0:
+                value = '(%s >> %s)' % (value, u(-shift))
+            terms.append('(%s & 0x%02XU)' % (value, octet_mask(f, k)))
+        if fx is not None and k in fx:
+            terms.append(fx[k])
+        if not terms:
+            lines.append('raw[%d] = 0U;' % k)
+        elif len(terms) == 1:
+            lines.append('raw[%d] = (u8)%s;' % (k, terms[0]))
+        else:
+            # Three terms per line, continued as in the hand-written items
+            rows = [' | '.join(terms[i:i + 3]) for i in range(0, len(terms), 3)]
+            lines.append('raw[%d] = (u8)(%s' % (k, rows[0]))
+            lines += ['            | %s' % row for row in rows[1:]]
+            lines[-1] += ');'
+    return octets
+
+
+def pack_lines(layout, value_of, fx=None):
+    return [line for octet in pack_octets(layout, value_of, fx) for line in octet]
+
+
+def unpack_expr(field):
+    """C expression of the raw (unsigned) value of a field from raw[]"""
+    terms = []
+    for k in octets_of(field):
+        shift = 8 * k + 8 - field.end
+        mask = octet_mask(field, k)
+        term = '((%s)raw[%d] & 0x%02XU)' % (field.word, k, mask) if mask != 0xFF else '(%s)raw[%d]' % (field.word, k)
+        if shift > 0:
+            term = '(%s >> %s)' % (term, u(shift))
+        elif shift < 0:
+            term = '(%s << %s)' % (term, u(-shift))
+        terms.append(term)
+    if len(terms) > 1:
+        return '(%s)' % ' | '.join(terms)
+    return terms[0] if terms[0].startswith('((') else '(%s)' % terms[0]
+
+
+def signed_expr(field, expr):
+    """Sign-extend the field width of expr into the raw type of the field"""
+    if field.width == field.bits:
+        return '(%s)%s' % (field.raw_type, expr)
+    sign = '0x%XU' % (1 << (field.width - 1))
+    wide = 's64' if field.word == 'u64' else 's32'
+    return '(%s)((%s)(%s ^ %s) - (%s)%s)' % (field.raw_type, wide, expr, sign, wide, sign)
+
+
+class Writer(object):
+    """Emits the code of one category"""
+
+    def __init__(self, cat, out_dir):
+        self.cat = cat
+        self.p = cat.prefix
+        self.inc_dir = os.path.join(out_dir, 'include', 'Categories', self.p)
+        self.src_dir = os.path.join(out_dir, 'src', 'Categories', self.p)
+
+    # ---- naming ----
+
+    def enum_type(self, owner, field):
+        return 'e%s_%s' % (owner, field.name)
+
+    def member_type(self, owner, field):
+        if field.kind == 'table':
+            return self.enum_type(owner, field)
+        if field.kind == 'quantity':
+            return 'ASTERIX_SCALED(%s)' % field.raw_type
+        return field.raw_type
+
+    def value_of(self, owner, ptr):
+        def value(field):
+            if field.kind == 'quantity':
+                return 'get_%s_%s_raw(%s)' % (owner, field.name, ptr)
+            return '%s->%s' % (ptr, field.name)
+        return value
+
+    def assign(self, owner, ptr, field):
+        expr = unpack_expr(field)
+        if field.signed:
+            expr = signed_expr(field, expr)
+        elif field.kind == 'table':
+            return '%s->%s = (%s)%s;' % (ptr, field.name, self.enum_type(owner, field), expr)
+        else:
+            expr = '(%s)%s' % (field.raw_type, expr)
+        if field.kind == 'quantity':
+            return 'set_%s_%s_raw(%s, %s);' % (owner, field.name, ptr, expr)
+        return '%s->%s = %s;' % (ptr, field.name, expr)
+
+    # ---- header pieces ----
+
+    def enums(self, owner, fields):
+        out = []
+        for f in fields:
+            if f.kind != 'table':
+                continue
+            etype = self.enum_type(owner, f)
+            seen = set()
+            out.append('typedef enum %s' % etype)
+            out.append('{')
+            for value, text in f.values:
+                name = c_ident(text) or 'VALUE'
+                if name in seen:
+                    name = '%s_%d' % (name, value)
+                seen.add(name)
+                out.append('    %s_%s = %d, /* %s */' % (etype, name, value, text.replace('*/', '* /')))
+            out.append('} %s;' % etype)
+            out.append('')
+        return out
+
+    def lsb_macros(self, owner, fields):
+        out = []
+        for f in fields:
+            if f.kind != 'quantity':
+                continue
+            unit = (' ' + f.unit) if f.unit else ''
+            out.append('/// @brief %s LSB = %s%s' % (f.title, f.lsb_text, unit))
+            out.append('#define %s_LSB_%s (%rF)' % (owner, f.name, float(f.lsb)))
+            out.append('')
+            out.append('/// @brief %s raw LSB counts per unit (1/LSB)' % f.title)
+            out.append('#define %s_SCALE_%s (%d.0 / %d.0)' % (owner, f.name, f.lsb.denominator, f.lsb.numerator))
+            out.append('')
+        return out
+
+    def members(self, owner, fields):
+        out = []
+        for f in fields:
+            if f.kind == 'quantity':
+                unit = (' ' + f.unit) if f.unit else ''
+                out.append('    /**')
+                out.append('     * @brief %s' % f.title)
+                out.append('     *')
+                out.append('     * LSB = %s%s' % (f.lsb_text, unit))
+                out.append('     */')
+            else:
+                out.append('    /// @brief %s' % f.title)
+            out.append('    %s %s;' % (self.member_type(owner, f), f.name))
+        return out
+
+    def accessors(self, owner, fields):
+        out = []
+        for f in fields:
+            if f.kind == 'quantity':
+                out.append('/// @brief get/set the %s (%s, or raw LSB count with the _raw variants)'
+                           % (f.title[:1].lower() + f.title[1:], f.unit or 'units'))
+                out.append('ASTERIX_SCALED_ACCESSORS(%s, %s, %s, %s_LSB_%s, %s_SCALE_%s)'
+                           % (owner, f.name, f.raw_type, owner, f.name, owner, f.name))
+        return out
+
+    def field_meta(self, table, owner, fields, base_bit=0):
+        """FieldMeta table of a group of fields, and the label tables it uses"""
+        labels, meta = [], []
+        for f in fields:
+            if f.width > 32:
+                meta.append('    /* %s: wider than FIELD_MAX_WIDTH, no metadata */' % f.name)
+                continue
+            bit = base_bit + f.bit
+            if f.kind == 'table':
+                name = '%s_%s_LABELS' % (owner, f.name)
+                entries = ', '.join('{ %dU, "%s" }' % (v, c_ident(t) or 'VALUE') for v, t in f.values)
+                labels.append('static const FieldLabel %s[] = { %s };' % (name, entries))
+                meta.append('    FIELD_ENUM("%s", %s, %s, %s),' % (f.name, u(bit), u(f.width), name))
+            else:
+                macro = 'FIELD_SIGNED' if f.signed else 'FIELD_UNSIGNED'
+                unit = ('"%s"' % f.unit) if f.unit else 'NULL'
+                comment = ('    /* %s */' % f.lsb_text) if f.lsb.denominator != 1 else ''
+                meta.append('    %s("%s", %s, %s, %d, %s, %s),%s'
+                            % (macro, f.name, u(bit), u(f.width), f.lsb.numerator, u(f.lsb.denominator), unit, comment))
+        out = labels + ([''] if labels else [])
+        out.append('static const FieldMeta %s[] =' % table)
+        out.append('{')
+        out += meta if meta else ['    FIELD_UNSIGNED(NULL, 0U, 0U, 1, 1U, NULL),']
+        out.append('};')
+        out.append('')
+        return out
+
+    def print_fields(self, owner, ptr, fields, indent='    ', prefix='- '):
+        out = []
+        for f in fields:
+            if f.kind == 'quantity':
+                out.append('#ifdef ASTERIX_NO_FLOAT')
+                out.append('%sprintf("%s%s = %%ld x %s\\n", (long)get_%s_%s_raw(%s));'
+                           % (indent, prefix, f.name, f.lsb_text, owner, f.name, ptr))
+                out.append('#else')
+                out.append('%sprintf("%s%s = %%f\\n", get_%s_%s(%s));' % (indent, prefix, f.name, owner, f.name, ptr))
+                out.append('#endif')
+            elif f.signed:
+                out.append('%sprintf("%s%s = %%ld\\n", (long)%s->%s);' % (indent, prefix, f.name, ptr, f.name))
+            elif f.width > 32:
+                out.append('%sprintf("%s%s = 0x%%llX\\n", (unsigned long long)%s->%s);' % (indent, prefix, f.name, ptr, f.name))
+            else:
+                out.append('%sprintf("%s%s = %%lu\\n", (unsigned long)%s->%s);' % (indent, prefix, f.name, ptr, f.name))
+        return out
+
+    # ---- files ----
+
+    def write(self, directory, name, lines):
+        os.makedirs(directory, exist_ok=True)
+        with open(os.path.join(directory, name), 'w') as fp:
+            fp.write('\n'.join(align_defines(lines)).rstrip('\n') + '\n')
+
+    def file_header(self, name, brief):
+        return [
+            '/**',
+            ' * @file %s' % name,
+            ' * @brief %s' % brief,
+            ' *',
+            ' * Generated by tools/asterix_gen.py from the specification of Category',
+            ' * %03d, edition %s: do not edit, edit the specification instead.' % (self.cat.number, self.cat.edition),
+            ' */',
+        ]
+
+    def item_header(self, item):
+        p, t = self.p, item.type
+        guard = '%s_H' % t
+        out = self.file_header('%s.h' % t, 'Data item %s - %s' % (item.label, item.title))
+        out += ['#ifndef %s' % guard, '#define %s' % guard, '',
+                '/* Standard libraries */', '#include <stdint.h>', '',
+                '/* Project libraries */', '#include <Infra/infra.h>', '#include <Infra/field.h>']
+        if item.kind == 'EXPLICIT':
+            out.append('#include <Infra/explicit.h>')
+        out += ['#include <Common/visibility.h>', '#include <Common/common_types.h>', '',
+                '#ifdef __cplusplus', 'extern "C" {', '#endif', '', banner('MACROS'), '']
+
+        entry = '%s_ENTRY' % t
+        if item.kind == 'FIXED':
+            out += ['/// @brief Length of the data item in octets', '#define %s_LEN %s' % (t, u(item.layout.len)), '']
+        elif item.kind == 'EXTENDED':
+            out += ['/// @brief Max. length of the data item in octets (every extent present)',
+                    '#define %s_MAX_LEN %s' % (t, u(item.layout.len)), '']
+        elif item.kind == 'REPETITIVE':
+            out += ['/// @brief Max. number of repetitions',
+                    '#define %s_MAX_REP 255' % t, '',
+                    '/// @brief Length in octets of one repetition',
+                    '#define %s_LEN %s' % (entry, u(item.layout.len)), '',
+                    '/// @brief Length of the data item in octets for a given repetition factor',
+                    '#define %s_LEN(REP) (1U + (%s * (size_t)(REP)))' % (t, '%s_LEN' % entry), '']
+        owners = self.owners(item)
+        for owner, layout in owners:
+            out += self.lsb_macros(owner, layout.fields)
+
+        out += [banner('ENUMS'), '']
+        for owner, layout in owners:
+            out += self.enums(owner, layout.fields)
+
+        out += [banner('STRUCTS'), '']
+        if item.kind == 'COMPOUND':
+            for n, sub in enumerate(item.subfields):
+                if sub is None:
+                    continue
+                owner = '%s_EXT%d' % (t, n + 1)
+                out += ['/**', ' * @brief Subfield #%d of %s - %s' % (n + 1, item.label, sub[1]), ' */',
+                        'typedef struct %s' % owner, '{']
+                out += self.members(owner, sub[2].fields) or ['    /// @brief Spare bits set to zero', '    ePresenceFlag spare;']
+                out += ['} %s;' % owner, '']
+        if item.kind == 'REPETITIVE':
+            out += ['/**', ' * @brief One repetition of %s' % item.label, ' */',
+                    'typedef struct %s' % entry, '{']
+            out += self.members(entry, item.layout.fields)
+            out += ['} %s;' % entry, '']
+
+        out += ['/**', ' * @typedef %s' % t, ' * @brief Data item %s - %s' % (item.label, item.title)]
+        if item.definition:
+            out += [' *', ' * %s' % item.definition]
+        if item.kind == 'REPETITIVE':
+            out += [' *',
+                    ' * The repetitions are not copied into the structure: RAW points to them as',
+                    ' * on the wire, and they are unpacked on demand with get_%s(). To' % entry,
+                    ' * encode, RAW points to REP * %s_LEN octets filled with set_%s().' % (entry, entry)]
+        if item.kind == 'EXPLICIT':
+            out += [' *', ' * Explicit-length field kept as on the wire (see explicit.h).']
+        out += [' */', 'typedef struct %s' % t, '{']
+        if item.kind in ('FIXED', 'EXTENDED'):
+            out += self.members(t, item.layout.fields)
+            for n in range(len(item.extents) - 1):
+                out += ['    /// @brief Extension into extent #%d (0: last extent, 1: more to come)' % (n + 2),
+                        '    ePresenceFlag FX%d;' % (n + 1)]
+        elif item.kind == 'REPETITIVE':
+            out += ['    /// @brief Repetition factor', '    u8 REP;',
+                    '    /// @brief REP repetitions as on the wire, NULL if REP is 0', '    const u8 * RAW;']
+        elif item.kind == 'COMPOUND':
+            spare = 0
+            for n, sub in enumerate(item.subfields):
+                if sub is None:
+                    spare += 1
+                    out += ['    /// @brief Subfield #%d: Spare bit set to zero' % (n + 1),
+                            '    ePresenceFlag spare%d;' % spare]
+                else:
+                    out += ['    /// @brief Subfield #%d: %s (0: absent, 1: present)' % (n + 1, sub[1]),
+                            '    ePresenceFlag %s;' % sub[0]]
+            out += ['    /// @brief Field Extension (0: last octet, 1: more to come)', '    ePresenceFlag FX;', '']
+            for n, sub in enumerate(item.subfields):
+                if sub is not None:
+                    out += ['    /// @brief Subfield #%d: %s' % (n + 1, sub[1]),
+                            '    %s_EXT%d ext%d;' % (t, n + 1, n + 1)]
+        else:
+            out += ['    /// @brief Length of the item in octets, length octet included', '    u8 LEN;',
+                    '    /// @brief Payload of EXPLICIT_DATA_LEN(LEN) octets (NULL if empty)', '    const u8 * DATA;']
+        out += ['} %s;' % t, '']
+
+        acc = []
+        for owner, layout in owners:
+            acc += self.accessors(owner, layout.fields)
+        out += [banner('ACCESSORS'), ''] + acc + ([''] if acc else [])
+        if item.kind == 'REPETITIVE':
+            out += ['/// @brief Unpack the repetition at the given index (below REP)',
+                    'ASTERIX_LIB void get_%s(const %s *item, u8 index, %s *entry);' % (entry, t, entry), '',
+                    '/// @brief Pack the repetition at the given index of a buffer to encode (%s_LEN octets each)' % entry,
+                    'ASTERIX_LIB void set_%s(u8 *raw, u8 index, const %s *entry);' % (entry, entry), '']
+
+        what = '%s (%s)' % (item.label, item.title)
+        out += [banner('DE/ENCODE'), '',
+                '/** @brief Encode item %s into a raw ASTERIX message.' % what, ' *',
+                ' * @param[in/out] bs Pointer to the BitStream (must not be NULL)',
+                ' * @param[in] item Pointer to the %s structure (must not be NULL)' % t, ' */',
+                'ASTERIX_LIB void encode_%s(BitStream *bs, const %s *item);' % (t, t), '',
+                '/** @brief Decode item %s from a raw ASTERIX message.' % what, ' *',
+                ' * @param[in/out] bs Pointer to the BitStream (must not be NULL)',
+                ' * @param[in/out] item Pointer to the %s structure (must not be NULL)' % t, ' */',
+                'ASTERIX_LIB void decode_%s(BitStream *bs, %s *item);' % (t, t), '']
+        if item.kind == 'FIXED':
+            out += ['/** @brief Decode item %s from its raw octets.' % what, ' *',
+                    ' * @param[in] raw The %s_LEN octets of the item (must not be NULL)' % t,
+                    ' * @param[out] item Pointer to the %s structure (must not be NULL)' % t, ' */',
+                    'ASTERIX_LIB void read_%s(const u8 *raw, %s *item);' % (t, t), '']
+        out += ['/** @brief Length in octets of the data item %s at the current position, without decoding it.' % item.label, ' *',
+                ' * @param[in/out] bs Pointer to the BitStream (must not be NULL)']
+        if item.kind == 'FIXED':
+            out += [' * @return Length of the item (%s_LEN)' % t]
+        else:
+            out += [' * @return Length of the item, or 0 if the item is not within the data',
+                    ' * (see bs_status())']
+        out += [' */', 'ASTERIX_LIB size_t length_%s(BitStream *bs);' % t, '',
+                '/** @brief Length in octets of the data item %s once encoded, without encoding it.' % item.label, ' *',
+                ' * @param[in] item Pointer to the %s structure (must not be NULL)' % t,
+                ' * @return ' + SIZE_RETURNS[item.kind].format(t), ' */',
+                'ASTERIX_LIB size_t encoded_size_%s(const %s *item);' % (t, t), '',
+                '/** @brief Move the BitStream past the data item %s without decoding it.' % item.label, ' *',
+                ' * @param[in/out] bs Pointer to the BitStream (must not be NULL)', ' */',
+                'ASTERIX_LIB void skip_%s(BitStream *bs);' % t, '']
+        if item.kind != 'EXPLICIT':
+            out += [banner('METADATA'), '',
+                    '/** @brief Field metadata of data item %s, see field.h */' % what,
+                    'ASTERIX_LIB extern const FieldItem %s_FIELDS;' % t, '']
+        out += [banner('EXTRA FUNCS'), '',
+                '/** @brief Print the contents of the given %s data item.' % item.label, ' *',
+                ' * @param item Pointer to the %s structure.' % t, ' */',
+                'ASTERIX_LIB void print_%s(const %s *item);' % (t, t)]
+        if item.expl:
+            out += ['',
+                    '/** @brief Decode the payload of %s with the plugin registered for it.' % item.label, ' *',
+                    ' * @param[in] item Pointer to the %s structure (must not be NULL)' % t,
+                    ' * @param[out] out User structure filled by the plugin',
+                    ' * @return Status of the plugin, or eAsterixStatus_ERR_PLUGIN if none is',
+                    ' * registered for Category %03d' % self.cat.number, ' */',
+                    'ASTERIX_LIB eAsterixStatus decode_%s_plugin(const %s *item, void *out);' % (t, t)]
+        out += ['', '#ifdef __cplusplus', '}', '#endif', '', '#endif /* %s */' % guard]
+        self.write(self.inc_dir, '%s.h' % t, out)
+
+    def owners(self, item):
+        """(structure, layout) of every group of fields of an item"""
+        if item.kind == 'COMPOUND':
+            return [('%s_EXT%d' % (item.type, n + 1), sub[2]) for n, sub in enumerate(item.subfields) if sub]
+        if item.kind == 'REPETITIVE':
+            return [('%s_ENTRY' % item.type, item.layout)]
+        if item.kind == 'EXPLICIT':
+            return []
+        return [(item.type, item.layout)]
+
+    def item_source(self, item):
+        p, t = self.p, item.type
+        out = self.file_header('%s.c' % t, 'Data item %s - %s' % (item.label, item.title))
+        out += ['#include <stddef.h>', '#include <stdio.h>', '#include <string.h>', '',
+                '#include <Categories/%s/%s.h>' % (p, t), '#include <Categories/%s/%s_config.h>' % (p, p)]
+        if item.kind == 'COMPOUND':
+            out.append('#include <Infra/compound.h>')
+        out += ['', '#if %s_WITH_%s' % (p, item.id), '', banner('DE/ENCODE'), '']
+
+        if item.kind == 'FIXED':
+            out += ['void encode_%s(BitStream *bs, const %s *item)' % (t, t), '{',
+                    '    u8 tmp[%s_LEN];' % t,
+                    '    u8 *raw = bs_write_ptr(bs, tmp, %s_LEN);' % t, '']
+            out += ['    ' + l for l in pack_lines(item.layout, self.value_of(t, 'item'))]
+            out += ['    bs_write_done(bs, raw, tmp, %s_LEN);' % t, '}', '',
+                    'void decode_%s(BitStream *bs, %s *item)' % (t, t), '{',
+                    '    u8 tmp[%s_LEN];' % t,
+                    '    read_%s(bs_read_ptr(bs, tmp, %s_LEN), item);' % (t, t), '}', '',
+                    'void read_%s(const u8 *raw, %s *item)' % (t, t), '{']
+            out += ['    ' + self.assign(t, 'item', f) for f in item.layout.fields]
+            if not item.layout.fields:
+                out.append('    (void)raw;')
+            out += ['}', '',
+                    'size_t length_%s(BitStream *bs)' % t, '{', '    (void)bs;', '    return %s_LEN;' % t, '}', '']
+        elif item.kind == 'EXTENDED':
+            out += self.extended_codecs(item)
+        elif item.kind == 'REPETITIVE':
+            out += self.repetitive_codecs(item)
+        elif item.kind == 'COMPOUND':
+            out += self.compound_codecs(item)
+        else:
+            out += ['void encode_%s(BitStream *bs, const %s *item)' % (t, t), '{',
+                    '    explicit_encode(bs, item->LEN, item->DATA);', '}', '',
+                    'void decode_%s(BitStream *bs, %s *item)' % (t, t), '{',
+                    '    item->DATA = explicit_decode(bs, &item->LEN);', '}', '',
+                    'size_t length_%s(BitStream *bs)' % t, '{', '    return explicit_length(bs);', '}', '']
+        out += self.size_codec(item)
+        if item.kind == 'FIXED':
+            out += ['void skip_%s(BitStream *bs)' % t, '{', '    bs_skip(bs, %s_LEN);' % t, '}', '']
+        else:
+            out += ['void skip_%s(BitStream *bs)' % t, '{', '    size_t len = length_%s(bs);' % t, '',
+                    '    if (len != 0U)', '        bs_skip(bs, len);', '}', '']
+
+        if item.kind != 'EXPLICIT':
+            out += [banner('METADATA'), '']
+            out += self.item_metadata(item)
+
+        out += [banner('EXTRA FUNCS'), '', '#if %s_WITH_PRINT' % p,
+                'void print_%s(const %s *item)' % (t, t), '{',
+                '    printf("%s - %s\\n");' % (item.label, item.title),
+                '    if (!item)', '    {', '        printf("%s: <null>\\n");' % item.label, '        return;', '    }', '']
+        if item.kind in ('FIXED', 'EXTENDED'):
+            out += self.print_fields(t, 'item', item.layout.fields)
+        elif item.kind == 'REPETITIVE':
+            entry = '%s_ENTRY' % t
+            out += ['    printf("- REP = %u\\n", item->REP);',
+                    '    for (u8 i = 0U; i < item->REP; i++)', '    {',
+                    '        %s entry;' % entry, '', '        get_%s(item, i, &entry);' % entry,
+                    '        printf("-- [%u]\\n", i);']
+            out += self.print_fields(entry, '(&entry)', item.layout.fields, indent='        ', prefix='--- ')
+            out += ['    }']
+        elif item.kind == 'COMPOUND':
+            for n, sub in enumerate(item.subfields):
+                if sub is None:
+                    continue
+                owner = '%s_EXT%d' % (t, n + 1)
+                out += ['    if (item->%s == ePresenceFlag_PRESENT)' % sub[0], '    {',
+                        '        printf("- %s\\n");' % sub[0]]
+                out += self.print_fields(owner, '(&item->ext%d)' % (n + 1), sub[2].fields, indent='        ', prefix='-- ')
+                out += ['    }']
+        else:
+            out += ['    explicit_print(item->LEN, item->DATA);']
+        out += ['}', '#endif /* %s_WITH_PRINT */' % p, '']
+        if item.expl:
+            out += ['eAsterixStatus decode_%s_plugin(const %s *item, void *out)' % (t, t), '{',
+                    '    return explicit_decode_plugin(%s, eExplicitField_%s, item->DATA, EXPLICIT_DATA_LEN(item->LEN), out);'
+                    % (u(self.cat.number), item.expl), '}', '']
+        out += ['#endif /* %s_WITH_%s */' % (p, item.id)]
+        self.write(self.src_dir, '%s.c' % t, out)
+
+    def size_codec(self, item):
+        """encoded_size_ of an item: its length computed from the structure"""
+        t = item.type
+        out = ['size_t encoded_size_%s(const %s *item)' % (t, t), '{']
+        if item.kind == 'FIXED':
+            out += ['    (void)item;', '    return %s_LEN;' % t]
+        elif item.kind == 'EXTENDED':
+            # Extents up to the first FX flag clear
+            extents = item.extents
+            out += ['    size_t len = %s;' % u(extents[0][1]), '']
+            for n in range(len(extents) - 1):
+                cond = ' && '.join('(item->FX%d == ePresenceFlag_PRESENT)' % (m + 1) for m in range(n + 1))
+                out += ['    if (%s)' % (cond[1:-1] if n == 0 else cond), '        len = %s;' % u(extents[n + 1][0] + extents[n + 1][1])]
+            out += ['    return len;']
+        elif item.kind == 'REPETITIVE':
+            out += ['    return %s_LEN(item->REP);' % t]
+        elif item.kind == 'COMPOUND':
+            out += ['    return compound_encoded_size(&%s_COMPOUND, item);' % t]
+        else:
+            out += ['    return item->LEN;']
+        return out + ['}', '']
+
+    def extended_codecs(self, item):
+        t = item.type
+        extents = item.extents
+        n_ext = len(extents)
+        out = []
+
+        # Encode: extents up to the first FX clear, FX set on all but the last
+        out += ['void encode_%s(BitStream *bs, const %s *item)' % (t, t), '{',
+                '    u8 tmp[%s_MAX_LEN];' % t, '    u8 *raw = NULL;', '    size_t len = encoded_size_%s(item);' % t,
+                '', '    if (!bs_require(bs, len))', '        return;', '    raw = bs_write_ptr(bs, tmp, len);', '']
+        fx = {}
+        for n, (start, length) in enumerate(extents[:-1]):
+            fx[start + length - 1] = '(u8)(len > %s)' % u(start + length)
+        octets = pack_octets(item.layout, self.value_of(t, 'item'), fx)
+        for n, (start, length) in enumerate(extents):
+            indent = '    '
+            if n > 0:
+                out += ['    if (len > %s)' % u(start), '    {']
+                indent = '        '
+            out += [indent + l for octet in octets[start:start + length] for l in octet]
+            if n > 0:
+                out += ['    }']
+        out += ['    bs_write_done(bs, raw, tmp, len);', '}', '']
+
+        # Decode: absent extents and their fields left cleared
+        out += ['void decode_%s(BitStream *bs, %s *item)' % (t, t), '{',
+                '    u8 tmp[%s_MAX_LEN];' % t, '    size_t len = length_%s(bs);' % t, '    const u8 *raw = NULL;', '',
+                '    memset(item, 0, sizeof(*item));', '    if (len == 0U)', '        return;',
+                '    raw = bs_read_ptr(bs, tmp, len);', '']
+        for n, (start, length) in enumerate(extents):
+            fields = [f for f in item.layout.fields if start * 8 <= f.bit < (start + length) * 8]
+            indent = '    '
+            if n > 0:
+                out += ['    if (len > %s)' % u(start), '    {', '        item->FX%d = ePresenceFlag_PRESENT;' % n]
+                indent = '        '
+            out += [indent + self.assign(t, 'item', f) for f in fields]
+            if n > 0:
+                out += ['    }']
+        out += ['}', '']
+
+        # Length: follow the FX bits ending the extents
+        out += ['size_t length_%s(BitStream *bs)' % t, '{']
+        for n, (start, length) in enumerate(extents[:-1]):
+            end = start + length
+            out += ['    if (!bs_require(bs, %s))' % u(end), '        return 0U;',
+                    '    if ((bs_peek_aligned_u8(bs, %s) & 1U) == 0U)' % u(end - 1), '        return %s;' % u(end)]
+        out += ['    if (!bs_require(bs, %s_MAX_LEN))' % t, '        return 0U;', '    return %s_MAX_LEN;' % t, '}', '']
+        return out
+
+    def repetitive_codecs(self, item):
+        t = item.type
+        entry = '%s_ENTRY' % t
+        out = ['void get_%s(const %s *item, u8 index, %s *entry)' % (entry, t, entry), '{',
+               '    const u8 *raw = &item->RAW[%s_LEN * (size_t)index];' % entry, '']
+        out += ['    ' + self.assign(entry, 'entry', f) for f in item.layout.fields]
+        out += ['}', '',
+                'void set_%s(u8 *raw, u8 index, const %s *entry)' % (entry, entry), '{',
+                '    raw += %s_LEN * (size_t)index;' % entry]
+        out += ['    ' + l for l in pack_lines(item.layout, self.value_of(entry, 'entry'))]
+        out += ['}', '',
+                'void encode_%s(BitStream *bs, const %s *item)' % (t, t), '{',
+                '    u8 tmp[%s_LEN * %s_MAX_REP];' % (entry, t), '    u8 *p = NULL;',
+                '    size_t n_bytes = %s_LEN * (size_t)item->REP;' % entry, '',
+                '    if (!bs_require(bs, %s_LEN(item->REP)))' % t, '        return;', '',
+                '    /* The repetitions are already in wire format */',
+                '    bs_serialize_aligned_u8(bs, item->REP);', '    p = bs_write_ptr(bs, tmp, n_bytes);',
+                '    if (n_bytes != 0U)', '        memcpy(p, item->RAW, n_bytes);',
+                '    bs_write_done(bs, p, tmp, n_bytes);', '}', '',
+                'void decode_%s(BitStream *bs, %s *item)' % (t, t), '{',
+                '    if (!bs_require(bs, 1U))', '        return;',
+                '    item->REP = bs_deserialize_aligned_u8(bs);', '    item->RAW = NULL;',
+                '    if (!bs_require(bs, %s_LEN(item->REP) - 1U))' % t, '        return;', '',
+                '    /* Repetitions stay where they are: they are unpacked on demand */',
+                '    if (item->REP != 0U)', '        item->RAW = bs_ref_ptr(bs, %s_LEN * (size_t)item->REP);' % entry, '}', '',
+                'size_t length_%s(BitStream *bs)' % t, '{',
+                '    if (!bs_require(bs, 1U))', '        return 0U;',
+                '    return %s_LEN(bs_peek_aligned_u8(bs, 0U));' % t, '}', '']
+        return out
+
+    def compound_codecs(self, item):
+        t = item.type
+        out = []
+        for n, sub in enumerate(item.subfields):
+            if sub is None:
+                continue
+            owner = '%s_EXT%d' % (t, n + 1)
+            out += ['/* Subfield #%d: %s */' % (n + 1, sub[1]),
+                    'static void encode_ext%d(u8 *raw, const void *sub)' % (n + 1), '{',
+                    '    const %s *ext = (const %s *)sub;' % (owner, owner), '']
+            if not sub[2].fields:
+                out.insert(-1, '    (void)ext;')
+            out += ['    ' + l for l in pack_lines(sub[2], self.value_of(owner, 'ext'))]
+            out += ['}', '', 'static void decode_ext%d(const u8 *raw, void *sub)' % (n + 1), '{',
+                    '    %s *ext = (%s *)sub;' % (owner, owner), '']
+            out += ['    ' + self.assign(owner, 'ext', f) for f in sub[2].fields]
+            if not sub[2].fields:
+                out += ['    (void)raw;', '    (void)ext;']
+            out += ['}', '']
+        out += ['#define %s_SUBFIELD(NAME, LEN, EXT) \\' % t,
+                '    { #NAME, (LEN), offsetof(%s, NAME), offsetof(%s, EXT), encode_##EXT, decode_##EXT }' % (t, t), '',
+                '#define %s_SPARE  { "spare", 0U, 0U, 0U, NULL, NULL }' % t, '',
+                '/* Subfields by bit of the primary subfield */',
+                'static const CompoundSubfield %s_SUBFIELDS[] =' % t, '{']
+        for n, sub in enumerate(item.subfields):
+            if sub is None:
+                out.append('    %s_SPARE,' % t)
+            else:
+                out.append('    %s_SUBFIELD(%s, %s, ext%d),' % (t, sub[0], u(sub[2].len), n + 1))
+        out += ['};', '',
+                'static const Compound %s_COMPOUND =' % t, '{', '    "%s",' % item.label,
+                '    sizeof(%s_SUBFIELDS) / sizeof(%s_SUBFIELDS[0]),' % (t, t),
+                '    %s_SUBFIELDS,' % t, '    offsetof(%s, FX),' % t, '};', '',
+                'void encode_%s(BitStream *bs, const %s *item)' % (t, t), '{',
+                '    compound_encode(bs, &%s_COMPOUND, item);' % t, '}', '',
+                'void decode_%s(BitStream *bs, %s *item)' % (t, t), '{',
+                '    compound_decode(bs, &%s_COMPOUND, item);' % t, '}', '',
+                'size_t length_%s(BitStream *bs)' % t, '{',
+                '    return compound_length(bs, &%s_COMPOUND);' % t, '}', '']
+        return out
+
+    def item_metadata(self, item):
+        t = item.type
+        out = []
+        if item.kind == 'COMPOUND':
+            groups = []
+            for n, sub in enumerate(item.subfields):
+                if sub is None:
+                    continue
+                table = '%s_EXT%d_FIELD_META' % (t, n + 1)
+                out += self.field_meta(table, '%s_EXT%d' % (t, n + 1), sub[2].fields)
+                groups.append('    FIELD_GROUP("ext%d", %s, %s),' % (n + 1, u(n), table))
+            out += ['/* Subfields by their member in %s and bit in the primary subfield */' % t]
+        else:
+            owner = '%s_ENTRY' % t if item.kind == 'REPETITIVE' else t
+            out += self.field_meta('%s_FIELD_META' % t, owner, item.layout.fields)
+            groups = ['    FIELD_GROUP(NULL, FIELD_NO_SUBFIELD, %s_FIELD_META),' % t]
+        out += ['static const FieldGroup %s_FIELD_GROUPS[] =' % t, '{'] + groups + ['};', '']
+        rep_len = u(item.layout.len) if item.kind == 'REPETITIVE' else '0U'
+        compound = '&%s_COMPOUND' % t if item.kind == 'COMPOUND' else 'NULL'
+        out += ['const FieldItem %s_FIELDS =' % t, '{',
+                '    "%s", (u8)eUapItemKind_%s, %s, %s, %s_FIELD_GROUPS, FIELD_COUNT(%s_FIELD_GROUPS),'
+                % (item.label, item.kind, rep_len, compound, t, t), '};', '']
+        return out
+
+    def config_header(self):
+        p = self.p
+        out = self.file_header('%s_config.h' % p, 'Build-time selection of the Category %03d data items' % self.cat.number)
+        out[-1:-1] = [' *',
+                      ' * Every item is built by default; defining %s_WITH_xxx to 0 compiles the' % p,
+                      ' * codecs of item %s/xxx out and makes its FRN spare, and %s_WITH_PRINT=0' % (p, p),
+                      ' * drops the print helpers (see I034_config.h).']
+        out += ['#ifndef %s_CONFIG_H' % p, '#define %s_CONFIG_H' % p, '',
+                '#ifdef __cplusplus', 'extern "C" {', '#endif', '', banner('MACROS'), '']
+        ids = [item.id for item in self.cat.items] + ['PRINT']
+        for i in ids:
+            out += ['#ifndef %s_WITH_%s' % (p, i), '    #define %s_WITH_%s 1' % (p, i), '#endif']
+        out += ['',
+                '/* %s_SELECT(ID, YES, NO) expands to YES if item %s/ID is built, NO otherwise */' % (p, p),
+                '#define %s_SELECT(ID, YES, NO)    %s_SELECT_##ID(YES, NO)' % (p, p),
+                '#define %s_IF(ID, X)              %s_SELECT_##ID(X, )' % (p, p), '',
+                '#define %s_SELECT_1(YES, NO)      YES' % p,
+                '#define %s_SELECT_0(YES, NO)      NO' % p,
+                '#define %s_SELECT_BOOL(FLAG, YES, NO)  %s_SELECT_BOOL_(FLAG, YES, NO)' % (p, p),
+                '#define %s_SELECT_BOOL_(FLAG, YES, NO) %s_SELECT_##FLAG(YES, NO)' % (p, p), '']
+        for item in self.cat.items:
+            out.append('#define %s_SELECT_%s(YES, NO)    %s_SELECT_BOOL(%s_WITH_%s, YES, NO)' % (p, item.id, p, p, item.id))
+        out += ['', '#ifdef __cplusplus', '}', '#endif', '', '#endif /* %s_CONFIG_H */' % p]
+        self.write(self.inc_dir, '%s_config.h' % p, out)
+
+    def category_header(self):
+        p, cat = self.p, self.cat
+        n_frn = len(cat.uap)
+        out = self.file_header('%s.h' % p, 'Category %03d - %s' % (cat.number, cat.title))
+        out += ['#ifndef %s_H' % p, '#define %s_H' % p, '',
+                '#ifdef __cplusplus', 'extern "C" {', '#endif', '',
+                '/* Project libraries */', '#include <Infra/infra.h>', '#include <Infra/uap.h>',
+                '#include <Infra/block.h>', '#include <Infra/field.h>', '#include <Categories/Registry.h>',
+                '#include <Categories/Header.h>',
+                '#include <Categories/FSPEC.h>', '#include <Common/common_types.h>', '']
+        out += ['#include <Categories/%s/%s.h>' % (p, item.type) for item in cat.items]
+        out += ['#include <Categories/%s/%s_config.h>' % (p, p), '', banner('MACROS'), '',
+                '/**', ' * Field-style access to the FSPEC of a record, by item name:',
+                ' * `%s_FSPEC_SET(&rec.FSPEC, %s)`' % (p, cat.items[0].type if cat.items else p), ' */',
+                '#define %s_FSPEC_GET(FSPEC_PTR, ITEM)             fspec_get((FSPEC_PTR), e%s_FRN_##ITEM)' % (p, p),
+                '#define %s_FSPEC_SET(FSPEC_PTR, ITEM)             fspec_set((FSPEC_PTR), e%s_FRN_##ITEM)' % (p, p),
+                '#define %s_FSPEC_CLEAR(FSPEC_PTR, ITEM)           fspec_clear((FSPEC_PTR), e%s_FRN_##ITEM)' % (p, p),
+                '#define %s_FSPEC_PUT(FSPEC_PTR, ITEM, FLAG)       fspec_put((FSPEC_PTR), e%s_FRN_##ITEM, (FLAG))' % (p, p), '',
+                '/// @brief Number of FRNs of the Category %03d UAP' % cat.number,
+                '#define %s_FRN_COUNT                              %s' % (p, u(n_frn)), '',
+                '/// @brief Item masks of the selective decoders (see decode_%s_record_masked())' % p,
+                '#define %s_MASK(ITEM)                             UAP_FRN_BIT(e%s_FRN_##ITEM)' % (p, p),
+                '#define %s_MASK_ALL                               UAP_FRN_UPTO(%s_FRN_COUNT)' % (p, p), '',
+                banner('ENUMS'), '',
+                '/**', ' * @brief Field Reference Number (FRN) of the Category %03d data items' % cat.number, ' */',
+                'typedef enum e%s_FRN' % p, '{']
+        for frn, item in enumerate(cat.uap, 1):
+            if item is not None:
+                out.append('    e%s_FRN_%s = %d, /* %s - %s */' % (p, item.type, frn, item.label, item.title))
+        out += ['} e%s_FRN;' % p, '', banner('STRUCTS'), '',
+                '/// @brief FSPEC of Category %03d messages (bit FRN - 1 set for present items)' % cat.number,
+                'typedef FSPEC %s_FSPEC;' % p, '',
+                '/**', ' * @typedef %s' % p,
+                ' * @brief Category %03d message composed of Header, FSPEC and all items' % cat.number, ' */',
+                'typedef struct %s' % p, '{', '    Header      HEADER;', '    %s_FSPEC  FSPEC;' % p]
+        out += ['    %s %s;' % (item.type, item.type) for item in cat.uap if item is not None]
+        out += ['} %s;' % p, '',
+                '/// @brief UAP of Category %03d' % cat.number, 'ASTERIX_LIB extern const Uap %s_UAP;' % p, '',
+                '/// @brief Field metadata of the items, indexed by FRN - 1 (see field.h)',
+                'ASTERIX_LIB extern const FieldItem *const %s_FIELDS[%s_FRN_COUNT];' % (p, p), '',
+                '/// @brief Codecs of Category %03d, see asterix_register_category()' % cat.number,
+                'ASTERIX_LIB extern const AsterixCategory %s_CATEGORY;' % p, '',
+                banner('DE/ENCODE'), '',
+                '/** @brief Append one record to the data block of the BitStream (see encode_I034()). */',
+                'ASTERIX_LIB eAsterixStatus encode_%s(BitStream *bs, const %s *item);' % (p, p), '',
+                '/** @brief Length of the data block holding the record once encoded (see encoded_size_I034()). */',
+                'ASTERIX_LIB size_t encoded_size_%s(const %s *item);' % (p, p), '',
+                '/** @brief Length of the record once encoded, without the block header (see encoded_size_I034_record()). */',
+                'ASTERIX_LIB size_t encoded_size_%s_record(const %s *item);' % (p, p), '',
+                '/** @brief Decode the first record of a data block (see decode_I034()). */',
+                'ASTERIX_LIB eAsterixStatus decode_%s(BitStream *bs, %s *item);' % (p, p), '',
+                '/** @brief Decode the items in mask of the record at the current position (see decode_I034_record_masked()). */',
+                'ASTERIX_LIB eAsterixStatus decode_%s_record_masked(BitStream *bs, %s *item, u64 mask);' % (p, p), '',
+                '/** @brief Decode up to n_items records of a data block (see decode_I034_batch_masked()). */',
+                'ASTERIX_LIB size_t decode_%s_batch_masked(BitStream *bs, %s *items, size_t n_items, u64 mask);' % (p, p), '',
+                '/** @brief Move past the record at the current position (see skip_I034_record()). */',
+                'ASTERIX_LIB eAsterixStatus skip_%s_record(BitStream *bs);' % p, '',
+                banner('EXTRA FUNCS'), '',
+                '/** @brief Compile a field path of Category %03d (e.g. "%s/...") into an accessor, see field_compile(). */'
+                % (cat.number, p),
+                'ASTERIX_LIB eAsterixStatus compile_%s_field(FieldAccessor *acc, const char *path);' % p, '',
+                '/** @brief Print the present items of a decoded record. */',
+                'ASTERIX_LIB void print_%s(const %s *item);' % (p, p),
+                '', '#ifdef __cplusplus', '}', '#endif', '', '#endif /* %s_H */' % p]
+        self.write(self.inc_dir, '%s.h' % p, out)
+
+    def category_source(self):
+        p, cat = self.p, self.cat
+        out = self.file_header('%s.c' % p, 'Category %03d - %s' % (cat.number, cat.title))
+        out += ['#include <stddef.h>', '#include <stdio.h>', '', '#include <Categories/%s/%s.h>' % (p, p), '',
+                banner('UAP'), '',
+                '/* Adapt the typed item codecs to the generic UAP signatures */',
+                '#define %s_UAP_CODECS(ID)     %s_IF(ID, %s_UAP_ADAPTERS(ID))' % (p, p, p),
+                '#define %s_UAP_ADAPTERS(ID)                                           \\' % p,
+                '    static void uap_encode_%s_##ID(BitStream *bs, const void *item)   \\' % p,
+                '    {                                                                   \\',
+                '        encode_%s_##ID(bs, (const %s_##ID *)item);                  \\' % (p, p),
+                '    }                                                                   \\',
+                '    static void uap_decode_%s_##ID(BitStream *bs, void *item)         \\' % p,
+                '    {                                                                   \\',
+                '        decode_%s_##ID(bs, (%s_##ID *)item);                        \\' % (p, p),
+                '    }                                                                   \\',
+                '    static size_t uap_size_%s_##ID(const void *item)                  \\' % p,
+                '    {                                                                   \\',
+                '        return encoded_size_%s_##ID((const %s_##ID *)item);         \\' % (p, p),
+                '    }', '',
+                '/* Fixed-length items are also read straight from their octets (see UapReadFn) */',
+                '#define %s_UAP_READER(ID)     %s_IF(ID, %s_UAP_READ_ADAPTER(ID))' % (p, p, p),
+                '#define %s_UAP_READ_ADAPTER(ID)                                       \\' % p,
+                '    static void uap_read_%s_##ID(const u8 *data, void *item)          \\' % p,
+                '    {                                                                   \\',
+                '        read_%s_##ID(data, (%s_##ID *)item);                        \\' % (p, p),
+                '    }', '',
+                '#define %s_UAP_ITEM(ID, KIND, LEN, READ)                              \\' % p,
+                '    { "%s/" #ID, (KIND), (LEN), offsetof(%s, %s_##ID),            \\' % (p, p, p),
+                '      %s_SELECT(ID, uap_encode_%s_##ID, NULL),                      \\' % (p, p),
+                '      %s_SELECT(ID, uap_decode_%s_##ID, NULL),                      \\' % (p, p),
+                '      %s_SELECT(ID, length_%s_##ID, NULL),                          \\' % (p, p),
+                '      %s_SELECT(ID, uap_size_%s_##ID, NULL),                        \\' % (p, p),
+                '      %s_SELECT(ID, READ, NULL) }' % p, '',
+                '#define %s_UAP_SPARE  { NULL, eUapItemKind_FIXED, 0U, 0U, NULL, NULL, NULL, NULL, NULL }' % p, '',
+                '/* Valid mask bit of an item: set only if the item is built */',
+                '#define %s_UAP_VALID(ID)                                              \\' % p,
+                '    ((u64)%s_SELECT(ID, 1U, 0U) << (e%s_FRN_%s_##ID - 1U))' % (p, p, p), '']
+        items = [item for item in cat.uap if item is not None]
+        out += ['%s_UAP_CODECS(%s)' % (p, item.id) for item in items]
+        out += [''] + ['%s_UAP_READER(%s)' % (p, item.id) for item in items if item.kind == 'FIXED']
+        out += ['', 'static const UapItem %s_UAP_ITEMS[%s_FRN_COUNT] = {' % (p, p)]
+        for frn, item in enumerate(cat.uap, 1):
+            if item is None:
+                out.append('    %s_UAP_SPARE, /* FRN %d */' % (p, frn))
+            else:
+                fixed = item.kind == 'FIXED'
+                length = '%s_LEN' % item.type if fixed else '0U'
+                read = 'uap_read_%s' % item.type if fixed else 'NULL'
+                out.append('    %s_UAP_ITEM(%s, eUapItemKind_%s, %s, %s), /* FRN %d */' % (p, item.id, item.kind, length, read, frn))
+        out += ['};', '', 'const Uap %s_UAP = {' % p, '    %s,' % u(cat.number), '    %s_FRN_COUNT,' % p,
+                '    %s_UAP_ITEMS,' % p]
+        out += ['    ' + ' |\n    '.join('%s_UAP_VALID(%s)' % (p, item.id) for item in items) + (',' if items else '0U,')]
+        out += ['};', '', '#undef %s_UAP_VALID' % p, '', banner('DE/ENCODE'), '',
+                'eAsterixStatus encode_%s(BitStream *bs, const %s *item)' % (p, p), '{',
+                '    if (uap_encode_fspec(bs, &%s_UAP, item->FSPEC.present) == eAsterixStatus_OK)' % p,
+                '        uap_encode_items(bs, &%s_UAP, item->FSPEC.present, item);' % p, '',
+                '    // HEADER (CAT and LEN)', '    if (bs_status(bs) == eAsterixStatus_OK)',
+                '        bs_serialize_header(bs, %s_UAP.cat);' % p, '', '    return bs_status(bs);', '}', '',
+                'size_t encoded_size_%s(const %s *item)' % (p, p), '{',
+                '    size_t len = encoded_size_%s_record(item);' % p, '',
+                '    return (len != 0U) ? (ASTERIX_BLOCK_HEADER_LEN + len) : 0U;', '}', '',
+                'size_t encoded_size_%s_record(const %s *item)' % (p, p), '{',
+                '    return uap_encoded_size(&%s_UAP, item->FSPEC.present, item);' % p, '}', '',
+                'eAsterixStatus decode_%s(BitStream *bs, %s *item)' % (p, p), '{',
+                '    // HEADER (CAT and LEN), validated once for the whole data block',
+                '    if (bs_validate_block(bs) != eAsterixStatus_OK)', '        return bs_status(bs);', '',
+                '    return decode_%s_record_masked(bs, item, %s_MASK_ALL);' % (p, p), '}', '',
+                'eAsterixStatus decode_%s_record_masked(BitStream *bs, %s *item, u64 mask)' % (p, p), '{',
+                '    u64 present = 0U;', '',
+                '    item->HEADER.CAT = bs_deserialize_cat(bs);', '    item->HEADER.LEN = bs_deserialize_len(bs);', '',
+                '    // FSPEC', '    item->FSPEC.present = 0U;',
+                '    if (uap_decode_fspec(bs, &%s_UAP, &present) != eAsterixStatus_OK)' % p,
+                '        return bs_status(bs);', '',
+                '    // ITEMS, the ones outside the mask skipped and reported absent',
+                '    item->FSPEC.present = present & mask;',
+                '    return uap_decode_selected(bs, &%s_UAP, present, mask, item);' % p, '}', '',
+                'size_t decode_%s_batch_masked(BitStream *bs, %s *items, size_t n_items, u64 mask)' % (p, p), '{',
+                '    size_t n = 0U;', '',
+                '    // HEADER (CAT and LEN), validated once per call for the whole data block',
+                '    if (bs_validate_block(bs) != eAsterixStatus_OK)', '        return 0U;', '',
+                '    // RECORDS, back to back up to LEN', '    while ((n < n_items) && (bs->byte_pos < bs->limit))', '    {',
+                '        if (decode_%s_record_masked(bs, &items[n], mask) != eAsterixStatus_OK)' % p,
+                '            break;', '        n++;', '    }', '    return n;', '}', '',
+                'eAsterixStatus skip_%s_record(BitStream *bs)' % p, '{', '    u64 present = 0U;', '',
+                '    // FSPEC, then every present item measured from its raw octets',
+                '    if (uap_decode_fspec(bs, &%s_UAP, &present) != eAsterixStatus_OK)' % p,
+                '        return bs_status(bs);', '    return uap_skip_items(bs, &%s_UAP, present);' % p, '}', '',
+                banner('METADATA'), '',
+                '#define %s_FIELD_ITEM(ID)     %s_SELECT(ID, &%s_##ID##_FIELDS, NULL)' % (p, p, p), '',
+                'const FieldItem *const %s_FIELDS[%s_FRN_COUNT] = {' % (p, p)]
+        for frn, item in enumerate(cat.uap, 1):
+            entry = 'NULL' if (item is None or item.kind == 'EXPLICIT') else '%s_FIELD_ITEM(%s)' % (p, item.id)
+            out.append('    %s, /* FRN %d */' % (entry, frn))
+        out += ['};', '', '#undef %s_FIELD_ITEM' % p, '',
+                'eAsterixStatus compile_%s_field(FieldAccessor *acc, const char *path)' % p, '{',
+                '    return field_compile(acc, %s_FIELDS, %s_FRN_COUNT, path);' % (p, p), '}', '',
+                banner('EXTRA FUNCS'), '', '#if %s_WITH_PRINT' % p,
+                'void print_%s(const %s *item)' % (p, p), '{',
+                '    printf("Category %03d - CAT = %%u, LEN = %%u\\n", item->HEADER.CAT, item->HEADER.LEN);' % cat.number]
+        for item in items:
+            out += ['%s_IF(%s, if (%s_FSPEC_GET(&item->FSPEC, %s)) print_%s(&item->%s);)'
+                    % (p, item.id, p, item.type, item.type, item.type)]
+        out += ['}', '#endif /* %s_WITH_PRINT */' % p, '', banner('REGISTRY'), '',
+                '/* Adapt the typed codecs to the generic AsterixCategory signatures */',
+                'static size_t registry_decode_%s(BitStream *bs, void *records, size_t n_records)' % p, '{',
+                '    return decode_%s_batch_masked(bs, (%s *)records, n_records, %s_MASK_ALL);' % (p, p, p), '}', '',
+                'static size_t registry_decode_masked_%s(BitStream *bs, void *records, size_t n_records, u64 mask)' % p, '{',
+                '    return decode_%s_batch_masked(bs, (%s *)records, n_records, mask);' % (p, p), '}', '',
+                'static eAsterixStatus registry_encode_%s(BitStream *bs, const void *record)' % p, '{',
+                '    return encode_%s(bs, (const %s *)record);' % (p, p), '}', '',
+                '#if %s_WITH_PRINT' % p,
+                'static void registry_print_%s(const void *record)' % p, '{',
+                '    print_%s((const %s *)record);' % (p, p), '}', '#else',
+                '    #define registry_print_%s     NULL' % p, '#endif', '',
+                'const AsterixCategory %s_CATEGORY = {' % p, '    %s,' % u(cat.number), '    "%s",' % p,
+                '    &%s_UAP,' % p, '    sizeof(%s),' % p, '    0U,',
+                '    registry_decode_%s,' % p, '    registry_decode_masked_%s,' % p,
+                '    registry_encode_%s,' % p, '    skip_%s_record,' % p, '    NULL,',
+                '    registry_print_%s,' % p, '};']
+        self.write(self.src_dir, '%s.c' % p, out)
+
+    def run(self):
+        for item in self.cat.items:
+            self.item_header(item)
+            self.item_source(item)
+        self.config_header()
+        self.category_header()
+        self.category_source()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the codecs of an ASTERIX category from its specification')
+    parser.add_argument('spec', help='specification of the category (asterix-specs JSON)')
+    parser.add_argument('out', help='output directory (include/ and src/ are created in it)')
+    args = parser.parse_args()
+
+    try:
+        with open(args.spec) as fp:
+            category = Category(json.load(fp))
+        Writer(category, args.out).run()
+    except (SpecError, KeyError, ValueError, TypeError) as err:
+        sys.stderr.write('%s: %s\n' % (args.spec, err))
+        return 1
+    print('%s: Category %03d edition %s, %d items -> %s'
+          % (args.spec, category.number, category.edition, len(category.items), args.out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,32 @@
+/**
+ * @file size_I034.c
+ * @brief Minimal Category 034 decoder and encoder, linked by `make size`
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Decodes the data block read from stdin and encodes it back: linked with
+ * --gc-sections, the program holds only the record loop of the library and
+ * the items it is built with (see I034_config.h).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <Common/constants.h>
+#include <Categories/I034/I034.h>
+
+int main(void)
+{
+    static u8 buffer[MAX_MESSAGE_LEN];
+    static I034 rec;
+    BitStream bs;
+    size_t len = fread(buffer, 1U, sizeof(buffer), stdin);
+
+    bs_init(&bs, buffer, len);
+    if (decode_I034(&bs, &rec) != eAsterixStatus_OK)
+        return EXIT_FAILURE;
+
+    bs_init(&bs, buffer, sizeof(buffer));
+    return (encode_I034(&bs, &rec) == eAsterixStatus_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}